@@ -10,11 +10,13 @@
  */
 //// begin system includes
 #include <string>
+#include <memory>
 #include <optional>
 #include <nlohmann/json.hpp>
 //// end system includes
 
 //// begin project specific includes
+#include <sival/core/voicecoil.hpp>
 #include <sival/libsival.hpp>
 //// end project specific includes
 
@@ -46,6 +48,12 @@ namespace SiVAL {
  * immediately converted to the appropriate SI standard for internal consistency and
  * fast retrieval. The class is designed to be read-only after construction.
  *
+ * All numbers are kept together in one `Parameters` block inside the object, so
+ * responses that read many parameters touch only a few cache lines. The descriptive
+ * strings live in a separately allocated block; strings that repeat across drivers
+ * (brand, manufacturer, source, type, nominal diameter, material) are interned in
+ * `SiVAL::Utils::StringInterner::global()` and shared by all drivers.
+ *
  * @section schema JSON-Schema for Loudspeaker Driver Specifications
  *
  * This JSON schema is used for the structured collection of technical data for
@@ -79,7 +87,8 @@ namespace SiVAL {
  * "pmax": { "type": "object", "properties": { "value": { "type": "number" }, "unit": { "type": "string" } }, "required": ["value", "unit"] },
  * "bl": { "type": "object", "properties": { "value": { "type": "number" }, "unit": { "type": "string" } }, "required": ["value", "unit"] },
  * "motor_constant": { "type": "object", "properties": { "value": { "type": "number" }, "unit": { "type": "string" } }, "required": ["value", "unit"] },
- * "flux_density": { "type": "object", "properties": { "value": { "type": "number" }, "unit": { "type": "string" } }, "required": ["value", "unit"] }
+ * "flux_density": { "type": "object", "properties": { "value": { "type": "number" }, "unit": { "type": "string" } }, "required": ["value", "unit"] },
+ * "voice_coil": { "type": ["object", "null"], "properties": { "model": { "type": "string", "enum": ["Simple", "LR2", "Wright", "Leach"] } }, "required": ["model"] }
  * },
  * "required": ["impedance", "sensitivity", "re", "le", "znom", "pe", "pmax", "bl", "motor_constant", "flux_density"]
  * },
@@ -163,6 +172,7 @@ namespace SiVAL {
  * | `bl`             | Force factor (B*l).            | `NA`, `Tm`          | **Newton per Ampere, Tesla-Meter** | **Tesla-meter** (Tm)        |
  * | `motor_constant` | Motor constant (Bl/√Re).       | `N_sqrtW`           | **Newton per square-root-Watt** | **N/√W** |
  * | `flux_density`   | Magnetic flux density.         | `T`, `G`            | **Tesla, Gauss** | **Tesla** (T)               |
+ * | `voice_coil`     | Optional voice coil model (see `SiVAL::VoiceCoil`). | `model` and its parameters: `r2` (`Ohm`), `l2` (`H`) for `LR2`; `krm`, `erm`, `kxm`, `exm` for `Wright`; `k`, `n` for `Leach` | | |
  *
  * #### Thiele-Small Parameters (`thiele_small_parameters`)
  *
@@ -195,6 +205,48 @@ class LIB_SIVAL_EXPORT AbstractDriver
 
     //// begin public member methods
 public:
+    /**
+     * @struct Parameters
+     * @brief All numeric data of a driver in SI units, see the accessors of the same name.
+     */
+    struct Parameters {
+        // Electrical Parameters
+        double impedance = 0.0;
+        double sensitivity = 0.0;
+        double re = 0.0;
+        double le = 0.0;
+        double znom = 0.0;
+        double pe = 0.0;
+        double pmax = 0.0;
+        double bl = 0.0;
+        double motorConstant = 0.0;
+        double fluxDensity = 0.0;
+        // Thiele-Small Parameters
+        double fs = 0.0;
+        double qms = 0.0;
+        double qes = 0.0;
+        double qts = 0.0;
+        double mms = 0.0;
+        double mmd = 0.0;
+        double stiffness = 0.0;
+        double cms = 0.0;
+        double vas = 0.0;
+        double rms = 0.0;
+        double sd = 0.0;
+        std::optional<double> xmax;
+        std::optional<double> xlim;
+        std::optional<double> vd;
+        // Physical Dimensions
+        double vcDiameter = 0.0;
+        double windingHeight = 0.0;
+        double airGapHeight = 0.0;
+        double effectiveDiameter = 0.0;
+        double baffleCutoutDiameter = 0.0;
+        double volumeOccupied = 0.0;
+        double netWeight = 0.0;
+        SiVAL::VoiceCoil voiceCoil;
+    };
+
     /**
      * @brief Constructor that loads speaker data from a JSON file.
      * @details This constructor reads a JSON file according to the class schema. It
@@ -208,11 +260,35 @@ public:
      */
     explicit AbstractDriver(nlohmann::json &data);
 
+    /**
+     * @brief Constructor that parses the JSON text of a driver directly.
+     * @details The text is read with `nlohmann::json::sax_parse()`: the keys of
+     * `general_info`, `electrical_parameters`, `thiele_small_parameters` and
+     * `physical_dimensions` are recognised while reading, values and unit
+     * conversions are written straight into the driver. No JSON tree is built.
+     * Unknown keys are skipped. The result is the same as with the DOM constructor.
+     * @param begin The first character of the JSON text.
+     * @param end The position behind the last character.
+     * @throws nlohmann::json::parse_error If the JSON is malformed.
+     * @throws SiVAL::Exceptions::OutOfRange If a required field is missing or has the wrong type.
+     */
+    AbstractDriver(const char* begin, const char* end);
+
+    AbstractDriver(const AbstractDriver &other);
+    AbstractDriver(AbstractDriver &&other) noexcept;
+    AbstractDriver& operator=(const AbstractDriver &other);
+    AbstractDriver& operator=(AbstractDriver &&other) noexcept;
+
     /**
      * @brief Default destructor.
      */
     ~AbstractDriver();
 
+    /** * @brief Returns all numeric data of the driver at once.
+     * @return const Parameters& The parameters in SI units.
+     */
+    const Parameters& parameters() const;
+
     // --- General Info Accessors ---
 
     /** * @brief Returns the unique identifier (UUID) of the driver.
@@ -287,6 +363,12 @@ public:
      */
     double le() const;
 
+    /** * @brief Returns the voice coil model.
+     * @details Without a `voice_coil` entry in the JSON data this is the simple model with `le()`.
+     * @return const SiVAL::VoiceCoil& The voice coil impedance model.
+     */
+    const SiVAL::VoiceCoil& voiceCoil() const;
+
     /** * @brief Returns the nominal impedance (Znom) in Ohms. (Often same as `impedance`).
      * @return double The Znom value in Ohms.
      */
@@ -523,10 +605,33 @@ protected:
      * @return The calculated sensitivity in dB (1W/1m).
      */
     double calculateSensitivity() const;
+
+    /**
+     * @struct Provided
+     * @brief Tells which derivable parameters were given in the JSON data.
+     */
+    struct Provided {
+        bool qes = false;
+        bool qts = false;
+        bool cms = false;
+        bool stiffness = false;
+        bool vas = false;
+        bool vd = false;
+        bool sensitivity = false;
+    };
+
+    /**
+     * @brief Calculates every derivable parameter that was not given.
+     * @details The order matters: Qts needs Qes, Vas needs Cms and the sensitivity needs Vas and Qes.
+     * Shared by both constructors.
+     */
+    void deriveParameters(const Provided &provided);
     //// end protected member methods (internal use only)
 
     //// begin private member methods
 private:
+    class Reader;
+    struct Metadata;
     //// end private member methods
 
     //// begin public member
@@ -539,55 +644,9 @@ protected:
 
     //// begin private member
 private:
-    // Member variables for storing data
-    // General Info
-    std::string m_uuid;
-    std::string m_brand;
-    std::string m_manufacturer;
-    std::string m_providedby;
-    std::string m_comment;
-    std::string m_model;
-    bool m_indexed;
-    std::string m_speaker_type;
-
-    // Electrical Parameters
-    double m_impedance;
-    double m_sensitivity;
-    double m_re;
-    double m_le;
-    double m_znom;
-    double m_pe;
-    double m_pmax;
-    double m_bl;
-    double m_motor_constant;
-    double m_flux_density;
-
-    // Thiele-Small Parameters (in SI units)
-    double m_fs;
-    double m_qms;
-    double m_qes;
-    double m_qts;
-    double m_mms_kg;
-    double m_mmd_kg;
-    double m_stiffness;
-    double m_cms;
-    double m_vas_m3;
-    double m_rms;
-    double m_sd_m2;
-    std::optional<double> m_xmax_m;
-    std::optional<double> m_xlim_m;
-    std::optional<double> m_vd_m3;
-
-    // Physical Dimensions (in SI units)
-    std::string m_nominal_diameter;
-    double m_vc_diameter_m;
-    double m_winding_height_m;
-    double m_air_gap_height_m;
-    double m_effective_diameter_m;
-    double m_baffle_cutout_diameter_m;
-    double m_volume_occupied_m3;
-    double m_net_weight_kg;
-    std::string m_material;
+    // Numerische Daten zusammenhängend, Texte in einem eigenen Block
+    Parameters m_parameters;
+    std::unique_ptr<Metadata> m_metadata;
     //// end private member
 };
 }
@@ -1,10 +1,21 @@
 #pragma once
 
+#include <map>
 #include <string>
+#include <nlohmann/json.hpp>
 #include "sival/libsival.hpp" // For EnclosureType
 
 namespace SiVAL {
 
+/**
+ * @struct BafflePoint
+ * @brief A position on the front baffle in meters, measured from the lower left corner.
+ */
+struct BafflePoint {
+    double x = 0.0; ///< Horizontal position in meters.
+    double y = 0.0; ///< Vertical position in meters.
+};
+
 /**
  * @class AbstractEnclosure
  * @brief Abstract base class that defines the common interface and base data for enclosure types.
@@ -21,6 +32,11 @@ namespace SiVAL {
  *
  * The constructors are `protected` to ensure they can only be called by
  * derived classes.
+ *
+ * Besides the volume the enclosure describes its front baffle: a rectangle of
+ * `baffleWidth()` × `baffleHeight()` and the position of the driver of every
+ * role on it. A role without an explicit position sits in the center of the
+ * baffle. A size of 0 means that no baffle is defined.
  */
 class LIB_SIVAL_EXPORT AbstractEnclosure
 {
@@ -30,6 +46,39 @@ public:
      */
     virtual ~AbstractEnclosure();
 
+    /**
+     * @brief Returns the height of the front baffle.
+     * @return The height in meters.
+     */
+    double baffleHeight() const;
+
+    /**
+     * @brief Returns the width of the front baffle.
+     * @return The width in meters.
+     */
+    double baffleWidth() const;
+
+    /**
+     * @brief Returns the position of the driver of a role on the baffle.
+     * @return The position in meters. Without explicit position the center of the baffle.
+     */
+    SiVAL::BafflePoint driverPosition(SiVAL::DriverRole role) const;
+
+    /**
+     * @brief Sets the size of the front baffle.
+     * @param width The width in meters.
+     * @param height The height in meters.
+     */
+    void setBaffle(double width, double height);
+
+    /**
+     * @brief Sets the position of the driver of a role on the baffle.
+     * @param role The role of the driver.
+     * @param x The horizontal position of the driver center in meters.
+     * @param y The vertical position of the driver center in meters.
+     */
+    void setDriverPosition(SiVAL::DriverRole role, double x, double y);
+
     /**
      * @brief Sets the internal net volume of the enclosure.
      * @param vol The volume in liters.
@@ -72,11 +121,36 @@ protected:
      */
     explicit AbstractEnclosure(const std::string& json);
 
+    /**
+     * @brief Returns the front baffle as JSON: its size and the explicit driver positions.
+     * @details The positions are a list of `{"role", "x", "y"}` with the numeric value
+     * of the `DriverRole`, since two roles share the name "Woofer".
+     */
+    nlohmann::json baffleToJson() const;
+
+    /**
+     * @brief Reads the volume and the front baffle written by `toJson()`.
+     * @details Missing keys keep their current values.
+     * @param json The JSON string of the enclosure.
+     * @throws nlohmann::json::parse_error If the JSON is malformed.
+     * @throws nlohmann::json::type_error If a value has the wrong type.
+     */
+    void readJson(const std::string &json);
+
     /// The type identifier, set in the constructor by the derived class.
     SiVAL::EnclosureType m_type;
 
     /// The internal net volume of the enclosure in liters.
     double m_volume;
+
+    /// The width of the front baffle in meters.
+    double m_baffleWidth;
+
+    /// The height of the front baffle in meters.
+    double m_baffleHeight;
+
+    /// The explicit driver positions on the baffle.
+    std::map<SiVAL::DriverRole, SiVAL::BafflePoint> m_driverPositions;
 };
 
 } // namespace SiVAL
@@ -9,6 +9,7 @@
  *
  */
 //// begin system includes
+#include <vector>
 #include <nlohmann/json.hpp>
 //// end system includes
 
@@ -43,6 +44,7 @@ public:
     AcousticSetup(std::shared_ptr<SiVAL::Environment> env, const std::string &json);
     ~AcousticSetup();
     bool addDriver(SiVAL::DriverRole role, const std::string &json, int count);
+    bool addDriver(SiVAL::DriverRole role, std::shared_ptr<const SiVAL::AbstractDriver> driver, int count);
     bool addResponse(std::unique_ptr<AbstractResponse> response);
     RoleConfig* driverByRole(SiVAL::DriverRole role);
     SiVAL::AbstractEnclosure& enclosure();
@@ -50,7 +52,9 @@ public:
     void removeDriver(SiVAL::DriverRole role);
     void removeResponse(SiVAL::ResponseType type);
     AbstractResponse* responseByType(SiVAL::ResponseType type);
+    std::vector<SiVAL::DriverRole> roles() const;
     void setDriver(SiVAL::DriverRole role, const std::string &json, int count);
+    void setDriver(SiVAL::DriverRole role, std::shared_ptr<const SiVAL::AbstractDriver> driver, int count);
     void setResponse(SiVAL::ResponseType type, std::unique_ptr<AbstractResponse> respopnse);
     std::string toJson();
     //// end public member methods
@@ -0,0 +1,173 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/abstractions/abstractdriverresolver.hpp>
+#include <sival/abstractions/driver.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL {
+namespace Driver {
+/**
+ * @class Cache
+ * @brief Keeps parsed drivers by identifier, so that every driver is parsed once.
+ *
+ * @details `get()` returns the cached driver of an identifier or fetches its JSON
+ * text from an `AbstractDriverResolver` (e.g. a `FileResolver`) and parses it. All
+ * callers share one read-only instance, which can be put into any number of setups
+ * (`AcousticSetup::addDriver()`).
+ *
+ * The cache is split into shards by the hash of the identifier, each with its own
+ * lock and a least-recently-used list; when a shard is full its oldest driver is
+ * dropped (setups that hold it keep it alive). Threads asking for the same missing
+ * identifier at the same time wait for a single parse. A failed load is not cached,
+ * every waiting caller receives its exception.
+ *
+ * `prefetch()` loads a list of identifiers on a background thread, e.g. all
+ * drivers of the setups that are about to be restored.
+ *
+ * The resolver is called from the threads that call `get()` and from the prefetch
+ * threads, so it must be thread-safe if the cache is used concurrently.
+ */
+class LIB_SIVAL_EXPORT Cache
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @struct Settings
+     * @brief Size and layout of the cache.
+     */
+    struct Settings {
+        std::size_t capacity = 4096;  ///< Maximum number of drivers, split evenly over the shards.
+        std::size_t shards = 16;      ///< Number of independently locked shards.
+    };
+
+    /**
+     * @brief Constructor with the default settings.
+     */
+    explicit Cache(SiVAL::AbstractDriverResolver &resolver);
+
+    /**
+     * @brief Constructor.
+     * @param resolver Provides the JSON text of a driver. Must outlive the cache.
+     * @param settings Size and layout of the cache.
+     * @throws SiVAL::Exceptions::OutOfRange If the capacity or the number of shards is zero.
+     */
+    Cache(SiVAL::AbstractDriverResolver &resolver, const Settings &settings);
+    Cache(const Cache&) = delete;
+    Cache& operator=(const Cache&) = delete;
+
+    /**
+     * @brief Destructor, waits for running prefetches.
+     */
+    ~Cache();
+
+    /**
+     * @brief Removes all drivers.
+     */
+    void clear();
+
+    /**
+     * @brief Returns true if the driver of the identifier is cached or being loaded.
+     */
+    bool contains(const std::string &identifier) const;
+
+    /**
+     * @brief Returns the driver of an identifier, loading it on a miss.
+     * @throws The exception of the resolver or of the parser if the driver cannot be loaded.
+     */
+    std::shared_ptr<const SiVAL::AbstractDriver> get(const std::string &identifier);
+
+    /**
+     * @brief Returns the number of drivers parsed so far.
+     */
+    std::size_t loads() const;
+
+    /**
+     * @brief Loads drivers in the background.
+     * @details Identifiers that cannot be loaded are skipped; `get()` reports their error.
+     * @param identifiers The drivers to load.
+     * @param threads The number of threads, 0 selects the number of hardware threads.
+     * @return The number of identifiers whose driver is available, once all are done.
+     */
+    std::shared_future<std::size_t> prefetch(std::vector<std::string> identifiers, std::size_t threads = 1);
+
+    /**
+     * @brief Returns the number of cached drivers.
+     */
+    std::size_t size() const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    struct Shard;
+
+    std::shared_ptr<const SiVAL::AbstractDriver> load(const std::string &identifier);
+    Shard& shard(const std::string &identifier) const;
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    SiVAL::AbstractDriverResolver &m_resolver;
+    std::size_t m_shardCapacity;
+    std::size_t m_shardCount;
+    std::unique_ptr<Shard[]> m_shards;
+    std::atomic<std::size_t> m_loads;
+    std::atomic<std::uint64_t> m_tickets;
+    std::mutex m_prefetchMutex;
+    std::vector<std::shared_future<std::size_t>> m_prefetches;
+    //// end private member
+};
+}
+}
@@ -0,0 +1,163 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/abstractions/driver.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL {
+namespace Driver {
+/**
+ * @class Catalog
+ * @brief Loads a large number of drivers at once.
+ *
+ * @details A catalog is read from
+ *
+ * - a directory: every `*.json` file below it (recursively) is one driver,
+ * - a list of files, or
+ * - a JSONL file: every non-empty line is one driver.
+ *
+ * The documents are parsed in parallel with `SiVAL::Utils::parallelFor()`, each
+ * by the streaming constructor of `AbstractDriver` without a JSON tree. Every
+ * worker reads its files into its own buffer, which grows to the largest file
+ * and is then reused, so the loader does not allocate per file for the raw text.
+ * JSONL files are mapped into memory (`SiVAL::Utils::MappedFile`) and every line
+ * is parsed directly from the mapping.
+ *
+ * A broken document does not abort the run: its error is collected in `errors()`
+ * together with its file and line, all other drivers are loaded. Both lists keep
+ * the order of the input (for directories: sorted by path).
+ */
+class LIB_SIVAL_EXPORT Catalog
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @struct Entry
+     * @brief A loaded driver and where it comes from.
+     */
+    struct Entry {
+        std::shared_ptr<SiVAL::AbstractDriver> driver; ///< The driver.
+        std::string source;                            ///< The file.
+        std::size_t line = 0;                          ///< The line in a JSONL file (from 1), 0 for single documents.
+    };
+
+    /**
+     * @struct Error
+     * @brief A document that could not be loaded.
+     */
+    struct Error {
+        std::string source;                            ///< The file.
+        std::size_t line = 0;                          ///< The line in a JSONL file (from 1), 0 for single documents.
+        std::string message;                           ///< The message of the parser or of the driver.
+    };
+
+    /// Constructor (empty catalog)
+    Catalog();
+    /// Destructor
+    ~Catalog();
+
+    /**
+     * @brief Returns true if no driver was loaded.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the loaded drivers in the order of the input.
+     */
+    const std::vector<Entry>& entries() const;
+
+    /**
+     * @brief Returns the documents that could not be loaded, in the order of the input.
+     */
+    const std::vector<Error>& errors() const;
+
+    /**
+     * @brief Loads every `*.json` file below a directory.
+     * @param path The directory, searched recursively.
+     * @param threads The number of threads, 0 selects the number of hardware threads.
+     * @throws SiVAL::Exceptions::FileAccessError If the directory cannot be read.
+     */
+    static Catalog loadDirectory(const std::string &path, std::size_t threads = 0);
+
+    /**
+     * @brief Loads one driver per file.
+     * @details Files that cannot be read are reported in `errors()`.
+     * @param paths The JSON files.
+     * @param threads The number of threads, 0 selects the number of hardware threads.
+     */
+    static Catalog loadFiles(const std::vector<std::string> &paths, std::size_t threads = 0);
+
+    /**
+     * @brief Loads one driver per line of a JSONL file.
+     * @param path The JSONL file.
+     * @param threads The number of threads, 0 selects the number of hardware threads.
+     * @throws SiVAL::Exceptions::FileAccessError If the file cannot be opened.
+     */
+    static Catalog loadJsonl(const std::string &path, std::size_t threads = 0);
+
+    /**
+     * @brief Returns the number of loaded drivers.
+     */
+    std::size_t size() const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    std::vector<Entry> m_entries;
+    std::vector<Error> m_errors;
+    //// end private member
+};
+}
+}
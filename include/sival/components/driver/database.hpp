@@ -0,0 +1,295 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/abstractions/driver.hpp>
+#include <sival/utils/mappedfile.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL {
+namespace Driver {
+class Catalog;
+
+/**
+ * @class Database
+ * @brief A binary driver database, read through a memory mapping without copying.
+ *
+ * @details The file is written once from JSON drivers (`write()`, e.g. from a
+ * `Catalog`) and then opened in milliseconds: the constructor maps it into memory
+ * and checks the header, no value is parsed or converted. `at()` returns a `View`
+ * whose accessors read straight from the mapping.
+ *
+ * **Format (version 1)**
+ *
+ * | Offset          | Content                                                          |
+ * | :-------------- | :--------------------------------------------------------------- |
+ * | 0               | `Header` (64 bytes): magic `SIVALDB`, version, sizes, byte order |
+ * | `header.records`| `header.count` fixed-size `Record`s                              |
+ * | `header.strings`| the string pool: UTF-8 bytes without terminators                |
+ *
+ * A `Record` holds every parameter in SI units as returned by `AbstractDriver`
+ * (absent optionals are NaN), the voice coil model and references (`Text`) into
+ * the string pool. Equal strings (brands, materials, ...) are stored only once.
+ * The file uses the byte order of the writing machine, a file of the other byte
+ * order is rejected.
+ */
+class LIB_SIVAL_EXPORT Database
+{
+
+    //// begin public member methods
+public:
+    /// Version of the file format. Files of another version are rejected.
+    static constexpr std::uint32_t kVersion = 1;
+
+    /**
+     * @struct Text
+     * @brief A string in the string pool.
+     */
+    struct Text {
+        std::uint32_t offset;           ///< Offset from the start of the pool.
+        std::uint32_t length;           ///< Length in bytes.
+    };
+
+    /**
+     * @struct Record
+     * @brief One driver in SI units, as stored in the file.
+     */
+    struct Record {
+        // Electrical parameters
+        double impedance;
+        double sensitivity;
+        double re;
+        double le;
+        double znom;
+        double pe;
+        double pmax;
+        double bl;
+        double motorConstant;
+        double fluxDensity;
+        // Thiele-Small parameters
+        double fs;
+        double qms;
+        double qes;
+        double qts;
+        double mms;
+        double mmd;
+        double stiffness;
+        double cms;
+        double vas;
+        double rms;
+        double sd;
+        double xmax;                    ///< NaN if unknown.
+        double xlim;                    ///< NaN if unknown.
+        double vd;                      ///< NaN if unknown.
+        // Physical dimensions
+        double vcDiameter;
+        double windingHeight;
+        double airGapHeight;
+        double effectiveDiameter;
+        double baffleCutoutDiameter;
+        double volumeOccupied;
+        double netWeight;
+        // Voice coil: r2, l2, krm, erm, kxm, exm, k, n
+        double coil[8];
+        // General info
+        Text uuid;
+        Text brand;
+        Text manufacturer;
+        Text providedBy;
+        Text comment;
+        Text model;
+        Text speakerType;
+        Text nominalDiameter;
+        Text material;
+        std::uint32_t coilModel;        ///< `SiVAL::VoiceCoil::Model`.
+        std::uint32_t indexed;          ///< 0 or 1.
+    };
+
+    /**
+     * @struct Header
+     * @brief The first 64 bytes of the file.
+     */
+    struct Header {
+        char magic[8];                  ///< `SIVALDB` and a terminating zero.
+        std::uint32_t version;          ///< `kVersion`.
+        std::uint32_t recordSize;       ///< `sizeof(Record)`.
+        std::uint64_t count;            ///< Number of records.
+        std::uint64_t records;          ///< Offset of the first record.
+        std::uint64_t strings;          ///< Offset of the string pool.
+        std::uint64_t stringsSize;      ///< Size of the string pool in bytes.
+        std::uint32_t byteOrder;        ///< 0x01020304 in the byte order of the file.
+        std::uint32_t reserved[3];
+    };
+
+    /**
+     * @class View
+     * @brief Read-only access to one driver of the database.
+     * @details The accessors have the names and units of `AbstractDriver`; strings
+     * are views into the mapping. A view is valid as long as its database exists.
+     */
+    class LIB_SIVAL_EXPORT View
+    {
+    public:
+        View(const Record* record, const char* strings);
+
+        const Record& record() const;
+
+        std::string_view uuid() const;
+        std::string_view brand() const;
+        std::string_view manufacturer() const;
+        std::string_view providedBy() const;
+        std::string_view comment() const;
+        std::string_view model() const;
+        bool indexed() const;
+        std::string_view speakerType() const;
+
+        double impedance() const;
+        double sensitivity() const;
+        double re() const;
+        double le() const;
+        SiVAL::VoiceCoil voiceCoil() const;
+        double znom() const;
+        double pe() const;
+        double pmax() const;
+        double bl() const;
+        double motorConstant() const;
+        double fluxDensity() const;
+
+        double fs() const;
+        double qms() const;
+        double qes() const;
+        double qts() const;
+        double mms() const;
+        double mmd() const;
+        double stiffness() const;
+        double cms() const;
+        double vas() const;
+        double rms() const;
+        double sd() const;
+        std::optional<double> xmax() const;
+        std::optional<double> xlim() const;
+        std::optional<double> vd() const;
+
+        std::string_view nominalDiameter() const;
+        double vcDiameter() const;
+        double windingHeight() const;
+        double airGapHeight() const;
+        double effectiveDiameter() const;
+        double baffleCutoutDiameter() const;
+        double volumeOccupied() const;
+        double netWeight() const;
+        std::string_view material() const;
+
+    private:
+        std::string_view text(const Text &text) const;
+
+        const Record* m_record;
+        const char* m_strings;
+    };
+
+    /**
+     * @brief Opens a database file.
+     * @param path The file written by `write()`.
+     * @throws SiVAL::Exceptions::FileAccessError If the file cannot be mapped, is no driver
+     * database, has another version or byte order, or is truncated.
+     */
+    explicit Database(const std::string &path);
+    Database(Database &&other) noexcept;
+    Database& operator=(Database &&other) noexcept;
+    /// Destructor
+    ~Database();
+
+    /**
+     * @brief Returns the view of one driver.
+     * @throws SiVAL::Exceptions::OutOfRange If the index is not smaller than `size()`.
+     */
+    View at(std::size_t index) const;
+
+    /**
+     * @brief Returns the first record, e.g. for scans over all drivers.
+     */
+    const Record* records() const;
+
+    /**
+     * @brief Returns the number of drivers.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Writes the drivers of a catalog (see `write(const std::string&, const std::vector<std::shared_ptr<SiVAL::AbstractDriver>>&)`).
+     */
+    static void write(const std::string &path, const Catalog &catalog);
+
+    /**
+     * @brief Writes a database file.
+     * @param path The file, it is replaced.
+     * @param drivers The drivers in the order of the records.
+     * @throws SiVAL::Exceptions::FileAccessError If the file cannot be written.
+     * @throws SiVAL::Exceptions::OutOfRange If the string pool exceeds 4 GiB.
+     */
+    static void write(const std::string &path, const std::vector<std::shared_ptr<SiVAL::AbstractDriver>> &drivers);
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    SiVAL::Utils::MappedFile m_file;
+    const Record* m_records = nullptr;
+    const char* m_strings = nullptr;
+    std::size_t m_count = 0;
+    //// end private member
+};
+}
+}
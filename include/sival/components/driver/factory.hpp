@@ -10,6 +10,8 @@
  */
 //// begin system includes
 #include <memory>
+#include <string>
+#include <nlohmann/json.hpp>
 //// end system includes
 
 //// begin project specific includes
@@ -56,6 +58,20 @@ class LIB_SIVAL_EXPORT Factory
     //// begin public member methods
 public:
     static std::shared_ptr<AbstractDriver> create(SiVAL::DriverRole expectedRole, const std::string& jsonFilePath);
+
+    /**
+     * @brief Creates the driver for already parsed JSON data.
+     * @details Used by `Catalog`, which parses many documents in parallel.
+     * @param data Driver JSON data according to the schema of `AbstractDriver`.
+     */
+    static std::shared_ptr<AbstractDriver> create(nlohmann::json &data);
+
+    /**
+     * @brief Creates the driver by parsing its JSON text without building a JSON tree.
+     * @param begin The first character of the JSON text.
+     * @param end The position behind the last character.
+     */
+    static std::shared_ptr<AbstractDriver> create(const char* begin, const char* end);
     //// end public member methods
 
     //// begin public member methods (internal use only)
@@ -0,0 +1,111 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <string>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/abstractions/abstractdriverresolver.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL {
+namespace Driver {
+/**
+ * @class FileResolver
+ * @brief Resolves driver identifiers to JSON files.
+ *
+ * @details Follows the strategy recommended by `AbstractDriverResolver`: an
+ * identifier is first taken as a path. If no such file exists, it is a logical
+ * identifier (e.g. a UUID) and `<directory>/<identifier>.json` and then
+ * `<directory>/<identifier>` are tried in every search directory, in the order
+ * given. Files are read through a memory mapping.
+ *
+ * The resolver keeps no state besides its directories, so it may be used by
+ * several threads at once (e.g. by `Cache::prefetch()`).
+ */
+class LIB_SIVAL_EXPORT FileResolver : public SiVAL::AbstractDriverResolver
+{
+
+    //// begin public member methods
+public:
+    /// Constructor (identifiers are paths only)
+    FileResolver();
+
+    /**
+     * @brief Constructor with search directories for logical identifiers.
+     */
+    explicit FileResolver(std::vector<std::string> directories);
+
+    /// Destructor
+    ~FileResolver() override;
+
+    /**
+     * @brief Returns the search directories.
+     */
+    const std::vector<std::string>& directories() const;
+
+    /**
+     * @brief Returns the path of the file of an identifier.
+     * @throws SiVAL::Exceptions::FileAccessError If no file exists for the identifier.
+     */
+    std::string locate(const std::string &identifier) const;
+
+    /**
+     * @brief Returns the JSON text of the driver file of an identifier.
+     * @throws SiVAL::Exceptions::FileAccessError If no file exists or it cannot be read.
+     */
+    std::string resolve(const std::string &identifier) override;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    std::vector<std::string> m_directories;
+    //// end private member
+};
+}
+}
@@ -0,0 +1,223 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/abstractions/driver.hpp>
+#include <sival/components/driver/table.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL {
+namespace Driver {
+class Database;
+
+/**
+ * @class Index
+ * @brief Answers range queries over the Thiele-Small parameters of many drivers.
+ *
+ * @details A query is a list of ranges, e.g. `fs` in [25, 35] Hz, `qts` in
+ * [0.3, 0.45], `vas` < 0.06 m³ and `xmax` > 0.008 m. All values are in SI units,
+ * as returned by `AbstractDriver`. The result holds the positions of the matching
+ * drivers in the order in which they were indexed.
+ *
+ * Every parameter is stored twice: as a column of a `Table` in driver order and
+ * as a sorted copy with the driver positions. A query first counts the candidates of every
+ * range by binary search in the sorted copies. If the most selective range leaves
+ * few candidates, only those are checked against the other columns; otherwise all
+ * columns are scanned with branch-free loops that the compiler vectorises. Unknown
+ * values (e.g. a missing `xmax`) never match a range on that parameter.
+ *
+ * Drivers are also found by `uuid()`, `brand()` and `model()` (exact match).
+ *
+ * `insert()`, `replace()` and `erase()` update an index in place: a changed value
+ * is moved within the sorted copies instead of sorting them again, which keeps
+ * single edits of a large catalog cheap. An erased driver keeps its position
+ * (see `erased()`) until the index is built anew.
+ */
+class LIB_SIVAL_EXPORT Index
+{
+
+    //// begin public member methods
+public:
+    /// The parameters that can be queried (see `Table::Parameter`).
+    using Parameter = Table::Parameter;
+    /// Number of parameters.
+    static constexpr std::size_t kParameters = Table::kParameters;
+
+    /**
+     * @struct Range
+     * @brief A closed interval of one parameter. Leave a bound at its default for an open interval.
+     */
+    struct Range {
+        Parameter parameter;
+        double min = -std::numeric_limits<double>::infinity();
+        double max = std::numeric_limits<double>::infinity();
+    };
+
+    /// Constructor (empty index)
+    Index();
+
+    /**
+     * @brief Indexes drivers, e.g. the entries of a `Catalog`.
+     */
+    explicit Index(const std::vector<std::shared_ptr<SiVAL::AbstractDriver>> &drivers);
+
+    /**
+     * @brief Indexes all drivers of a database.
+     */
+    explicit Index(const Database &database);
+
+    /// Destructor
+    ~Index();
+
+    /**
+     * @brief Returns the positions of all drivers of a brand.
+     */
+    std::vector<std::size_t> brand(std::string_view name) const;
+
+    /**
+     * @brief Removes a driver from every query, its position stays reserved.
+     * @throws SiVAL::Exceptions::OutOfRange If the position is not smaller than `size()`.
+     */
+    void erase(std::size_t position);
+
+    /**
+     * @brief Returns true if the driver at a position was erased.
+     * @throws SiVAL::Exceptions::OutOfRange If the position is not smaller than `size()`.
+     */
+    bool erased(std::size_t position) const;
+
+    /**
+     * @brief Returns the positions of all drivers that lie in every range, in ascending order.
+     * @details An empty list of ranges matches every driver that is not erased.
+     * @throws SiVAL::Exceptions::OutOfRange If a range has an unknown parameter.
+     */
+    std::vector<std::size_t> find(const std::vector<Range> &ranges) const;
+
+    /**
+     * @brief Adds a driver at the end.
+     * @return The position of the driver.
+     * @throws SiVAL::Exceptions::OutOfRange If the index is full (2³² positions).
+     */
+    std::size_t insert(const SiVAL::AbstractDriver &driver);
+
+    /**
+     * @brief Returns the positions of all drivers with the model name.
+     */
+    std::vector<std::size_t> model(std::string_view name) const;
+
+    /**
+     * @brief Replaces the driver at a position (also an erased one).
+     * @throws SiVAL::Exceptions::OutOfRange If the position is not smaller than `size()`.
+     */
+    void replace(std::size_t position, const SiVAL::AbstractDriver &driver);
+
+    /**
+     * @brief Returns the number of positions, including erased drivers.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the columns of the indexed drivers, e.g. to screen the results of `find()`.
+     */
+    const Table& table() const;
+
+    /**
+     * @brief Returns the position of the driver with the UUID.
+     */
+    std::optional<std::size_t> uuid(std::string_view id) const;
+
+    /**
+     * @brief Returns a parameter of a driver (NaN if unknown).
+     * @throws SiVAL::Exceptions::OutOfRange If the position is not smaller than `size()`.
+     */
+    double value(std::size_t position, Parameter parameter) const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    struct Hash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view text) const;
+    };
+    using Positions = std::unordered_map<std::string, std::vector<std::size_t>, Hash, std::equal_to<>>;
+
+    /// UUID, brand and model of a position.
+    using Names = std::array<std::string, 3>;
+
+    template<class Source>
+    void add(const Source &driver, std::size_t position);
+    void build();
+    void link(std::size_t position, Names names);
+    static std::vector<std::size_t> lookup(const Positions &map, std::string_view name);
+    void sortIn(std::size_t position);
+    void sortOut(std::size_t position);
+    void unlink(std::size_t position);
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    Table m_table;
+    std::array<std::vector<double>, kParameters> m_sorted;
+    std::array<std::vector<std::uint32_t>, kParameters> m_order;
+    std::vector<Names> m_names;
+    std::vector<std::uint8_t> m_erased;
+    Positions m_uuids;
+    Positions m_brands;
+    Positions m_models;
+    //// end private member
+};
+}
+}
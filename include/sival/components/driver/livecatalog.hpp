@@ -0,0 +1,196 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/components/driver/catalog.hpp>
+#include <sival/components/driver/index.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL {
+namespace Driver {
+/**
+ * @class LiveCatalog
+ * @brief A driver directory that stays loaded and follows the edits of its files.
+ *
+ * @details The directory is loaded once like `Catalog::loadDirectory()`. Afterwards
+ * only files that were added, changed or removed are parsed again and applied to
+ * the `Index` with `Index::insert()`, `Index::replace()` and `Index::erase()`.
+ *
+ * Readers call `snapshot()` and keep working on the returned, immutable `Snapshot`
+ * for as long as they hold it. An update is prepared on a copy of the current
+ * snapshot and then published with one atomic pointer swap, so readers never wait
+ * for a reload and never see a half-applied one. The old snapshot is released when
+ * its last reader drops it.
+ *
+ * Changes are picked up by `refresh()`, which compares the modification time and
+ * size of every file, or automatically after `start()`: on Linux a background
+ * thread waits for inotify events of the directory tree and applies just the
+ * reported files; elsewhere, or if inotify is unavailable, it calls `refresh()` at
+ * the given interval.
+ *
+ * Erased drivers keep their position in the index until more than a quarter of
+ * the positions are erased or a large batch changes; then the index is built anew
+ * from the already parsed drivers.
+ */
+class LIB_SIVAL_EXPORT LiveCatalog
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @struct Snapshot
+     * @brief One consistent state of the catalog.
+     */
+    struct Snapshot {
+        /// The drivers by index position. The driver of an erased position is `nullptr`.
+        std::vector<Catalog::Entry> entries;
+        /// The index over `entries`.
+        Index index;
+        /// The files that cannot be loaded, sorted by path.
+        std::vector<Catalog::Error> errors;
+        /// Counts the published snapshots, starting with 1.
+        std::uint64_t version = 0;
+    };
+
+    /**
+     * @brief Loads every `*.json` file below a directory.
+     * @param directory The directory, searched recursively.
+     * @param threads The number of threads for parsing, 0 selects the number of hardware threads.
+     * @throws SiVAL::Exceptions::FileAccessError If the directory cannot be read.
+     */
+    explicit LiveCatalog(const std::string &directory, std::size_t threads = 0);
+    LiveCatalog(const LiveCatalog&) = delete;
+    LiveCatalog& operator=(const LiveCatalog&) = delete;
+
+    /**
+     * @brief Destructor, stops watching.
+     */
+    ~LiveCatalog();
+
+    /**
+     * @brief Returns the watched directory.
+     */
+    const std::string& directory() const;
+
+    /**
+     * @brief Compares all files with the last known state and applies the differences.
+     * @return The number of added, changed and removed files.
+     * @throws SiVAL::Exceptions::FileAccessError If the directory cannot be read; the snapshot is kept.
+     */
+    std::size_t refresh();
+
+    /**
+     * @brief Returns the current state. Never `nullptr`.
+     */
+    std::shared_ptr<const Snapshot> snapshot() const;
+
+    /**
+     * @brief Starts watching the directory on a background thread, scanning every second without inotify.
+     */
+    void start();
+
+    /**
+     * @brief Starts watching the directory on a background thread.
+     * @details Does nothing if already watching. Files changed since the last update
+     * are applied once the watches are in place, so no edit between loading and
+     * watching is lost. Errors of the background updates keep
+     * the current snapshot; they are retried with the next change.
+     * @param interval How often the directory is scanned when inotify is unavailable.
+     */
+    void start(std::chrono::milliseconds interval);
+
+    /**
+     * @brief Stops watching and waits for the background thread.
+     */
+    void stop();
+
+    /**
+     * @brief Returns true while the background thread is running.
+     */
+    bool watching() const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    /// The last known state of a file.
+    struct File {
+        std::filesystem::file_time_type time;
+        std::uintmax_t size = 0;
+    };
+    using Files = std::map<std::string, File>;
+    class Notifier;
+
+    void apply(const std::vector<std::string> &changed);
+    void compact(Snapshot &snapshot);
+    Files scan() const;
+    void watch(std::chrono::milliseconds interval);
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    std::string m_directory;
+    std::size_t m_threads;
+    std::atomic<std::shared_ptr<const Snapshot>> m_snapshot;
+    std::mutex m_update;
+    Files m_files;
+    std::map<std::string, std::size_t> m_positions;
+    std::map<std::string, std::string> m_errors;
+    std::thread m_thread;
+    std::atomic<bool> m_running;
+    //// end private member
+};
+}
+}
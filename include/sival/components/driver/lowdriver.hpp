@@ -43,6 +43,8 @@ class LIB_SIVAL_EXPORT LowDriver : public SiVAL::AbstractDriver
 public:
     /// Constructor
     explicit LowDriver(nlohmann::json &data);
+    /// Constructor that parses the JSON text directly (see `AbstractDriver`)
+    LowDriver(const char* begin, const char* end);
     /// Destructor
     virtual ~LowDriver();
     //// end public member methods
@@ -0,0 +1,213 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/abstractions/driver.hpp>
+#include <sival/utils/alignedallocator.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL {
+namespace Driver {
+class Database;
+
+/**
+ * @class Table
+ * @brief The Thiele-Small parameters of many drivers, stored column by column.
+ *
+ * @details Every parameter is one contiguous, 64-byte aligned array of doubles in
+ * SI units (as returned by `AbstractDriver`), one value per driver in the order of
+ * the input. A loop over one parameter of all drivers therefore reads only that
+ * parameter and no strings, which `AbstractDriver` keeps next to its values.
+ * Unknown values (e.g. a missing `xmax`) are NaN.
+ *
+ * Drivers can be appended, replaced and erased in place. An erased driver keeps
+ * its position with NaN in every column, so it drops out of every result.
+ *
+ * The kernels work on whole columns at once. `sealed()` answers "which drivers fit
+ * this cabinet": for one closed box volume it returns the system Q, the resonance,
+ * the -3 dB frequency and the maximum SPL of every driver.
+ */
+class LIB_SIVAL_EXPORT Table
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @brief The parameters of the table.
+     */
+    enum class Parameter {
+        Fs = 0,       ///< Resonance frequency in Hz.
+        Qts,          ///< Total quality factor.
+        Qes,          ///< Electrical quality factor.
+        Qms,          ///< Mechanical quality factor.
+        Vas,          ///< Equivalent volume in m³.
+        Sd,           ///< Piston area in m².
+        Xmax,         ///< Linear excursion in m.
+        Re,           ///< DC resistance in Ohm.
+        Le,           ///< Voice coil inductance in H.
+        Bl,           ///< Force factor in Tm.
+        Mms,          ///< Moving mass in kg.
+        Sensitivity,  ///< Sensitivity in dB (1 W / 1 m).
+        Pe,           ///< Rated power in W.
+        Impedance     ///< Nominal impedance in Ohm.
+    };
+    /// Number of parameters.
+    static constexpr std::size_t kParameters = 14;
+
+    /// A column: one value per driver, aligned to a cache line.
+    using Column = std::vector<double, SiVAL::Utils::AlignedAllocator<double, 64>>;
+
+    /**
+     * @struct Screen
+     * @brief The closed box alignment of every driver for one box volume.
+     */
+    struct Screen {
+        double volume = 0.0;    ///< The net box volume in m³.
+        Column qtc;             ///< Total Q of the system.
+        Column fc;              ///< Resonance of the system in Hz.
+        Column f3;              ///< -3 dB frequency in Hz.
+        Column maxSpl;          ///< Maximum SPL at `f3` in dB (1 m, half space).
+    };
+
+    /// Constructor (empty table)
+    Table();
+
+    /**
+     * @brief Builds the table from drivers, e.g. the entries of a `Catalog`.
+     */
+    explicit Table(const std::vector<std::shared_ptr<SiVAL::AbstractDriver>> &drivers);
+
+    /**
+     * @brief Builds the table from all drivers of a database.
+     */
+    explicit Table(const Database &database);
+
+    /// Destructor
+    ~Table();
+
+    /**
+     * @brief Appends a driver.
+     * @return The position of the driver.
+     */
+    std::size_t append(const SiVAL::AbstractDriver &driver);
+
+    /**
+     * @brief Returns the column of a parameter.
+     * @throws SiVAL::Exceptions::OutOfRange If the parameter is unknown.
+     */
+    const Column& column(Parameter parameter) const;
+
+    /**
+     * @brief Sets every parameter of a driver to NaN, its position stays reserved.
+     * @throws SiVAL::Exceptions::OutOfRange If the position is not smaller than `size()`.
+     */
+    void erase(std::size_t position);
+
+    /**
+     * @brief Replaces the parameters of the driver at a position.
+     * @throws SiVAL::Exceptions::OutOfRange If the position is not smaller than `size()`.
+     */
+    void replace(std::size_t position, const SiVAL::AbstractDriver &driver);
+
+    /**
+     * @brief Computes the closed box alignment of every driver (see `sealed(double, Screen&, std::size_t)`).
+     */
+    Screen sealed(double volume, std::size_t threads = 0) const;
+
+    /**
+     * @brief Computes the closed box alignment of every driver.
+     *
+     * @details With the compliance ratio α = Vas / Vb:
+     *
+     * - Qtc = Qts · √(1 + α), fc = fs · √(1 + α)
+     * - f3 = fc · √((a + √(a² + 4)) / 2) with a = 1 / Qtc² − 2, the -3 dB point of
+     *   the second order high-pass
+     * - maxSpl is the lower of the thermal limit (sensitivity + 10 · log10(Pe) − 3 dB)
+     *   and the excursion limit at f3 (Sd · Xmax radiating into half space at 1 m).
+     *   Without `xmax` only the thermal limit is used.
+     *
+     * The columns of `screen` are resized to `size()` and overwritten, so a screen
+     * can be reused for many volumes without allocating.
+     *
+     * @param volume The net box volume in m³.
+     * @param screen The result.
+     * @param threads The number of threads, 0 selects the number of hardware threads.
+     * @throws SiVAL::Exceptions::OutOfRange If the volume is not positive and finite.
+     */
+    void sealed(double volume, Screen &screen, std::size_t threads = 0) const;
+
+    /**
+     * @brief Returns the number of drivers (including erased positions).
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns a parameter of a driver (NaN if unknown).
+     * @throws SiVAL::Exceptions::OutOfRange If the position is not smaller than `size()`.
+     */
+    double value(std::size_t position, Parameter parameter) const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    using Row = std::array<double, kParameters>;
+
+    template<class Source>
+    static Row row(const Source &driver);
+    void add(const Row &values);
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    std::size_t m_count = 0;
+    std::array<Column, kParameters> m_columns;
+    //// end private member
+};
+}
+}
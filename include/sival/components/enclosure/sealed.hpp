@@ -44,6 +44,7 @@ public:
     explicit Sealed(const std::string &json);
     /// Destructor
     virtual ~Sealed();
+    std::string toJson() override;
     //// end public member methods
 
     //// begin public member methods (internal use only)
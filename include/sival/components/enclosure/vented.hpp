@@ -43,6 +43,7 @@ public:
     explicit Vented();
     explicit Vented(const std::string &json);
     virtual ~Vented();
+    std::string toJson() override;
     //// end public member methods
 
     //// begin public member methods (internal use only)
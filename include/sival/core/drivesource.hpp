@@ -0,0 +1,84 @@
+#pragma once
+
+namespace SiVAL {
+
+/**
+ * @class DriveSource
+ * @brief Describes the amplifier and the speaker cable that drive a role.
+ *
+ * @details The source is modelled as an ideal voltage source with a series
+ * resistance made of the amplifier output impedance and the resistance of both
+ * cable conductors. Without a crossover this resistance is added once to the
+ * electrical series resistance of the equivalent driver
+ * (`SiVAL::Response::DriverModel`), so it costs nothing per frequency. With a
+ * crossover it is the source impedance of the ladders in
+ * `SiVAL::Crossover::Solver`. It raises the effective \f$ Q_{es} \f$ and lowers
+ * the SPL, which is noticeable with long cables.
+ *
+ * The open circuit voltage of the source is either given directly
+ * (`Mode::ConstantVoltage`) or derived from a power rating
+ * (`Mode::ConstantPower`): \f$ U = \sqrt{P / R_e'} \cdot (R_e' + R_g) \f$, where
+ * \f$ R_e' \f$ is the DC resistance of the equivalent driver. The power \f$ P \f$
+ * is the one that reaches the drivers, so the series resistance does not change
+ * the level in this mode; the source supplies the loss in \f$ R_g \f$ on top.
+ */
+class LIB_SIVAL_EXPORT DriveSource
+{
+public:
+    /**
+     * @brief Selects how the source voltage is determined.
+     */
+    enum class Mode {
+        ConstantVoltage = 0, ///< The voltage is given by `voltage`.
+        ConstantPower        ///< The voltage delivers `power` into the DC resistance of the drivers, behind `resistance()`.
+    };
+
+    /**
+     * @brief Default constructor: ideal 2.83 V source without cable.
+     */
+    DriveSource() = default;
+
+    /**
+     * @brief Returns the resistance of a two-conductor copper cable in Ohm.
+     * @param length The length of the cable in meters (one way).
+     * @param crossSection The cross section of one conductor in mm².
+     */
+    static constexpr double copperCable(double length, double crossSection) {
+        // Spezifischer Widerstand von Kupfer bei 20 °C: 0.0178 Ohm mm²/m
+        return 2.0 * 0.0178 * length / crossSection;
+    }
+
+    /**
+     * @brief Returns the total series resistance of amplifier and cable in Ohm.
+     */
+    constexpr double resistance() const {
+        return outputImpedance + cableResistance;
+    }
+
+    /**
+     * @brief How the source voltage is determined.
+     */
+    Mode mode = Mode::ConstantVoltage;
+
+    /**
+     * @brief The open circuit voltage in Volt for `Mode::ConstantVoltage`.
+     */
+    double voltage = 2.83;
+
+    /**
+     * @brief The power in Watt for `Mode::ConstantPower`.
+     */
+    double power = 1.0;
+
+    /**
+     * @brief The output impedance of the amplifier in Ohm.
+     */
+    double outputImpedance = 0.0;
+
+    /**
+     * @brief The resistance of the speaker cable (both conductors) in Ohm.
+     */
+    double cableResistance = 0.0;
+};
+
+} // namespace SiVAL
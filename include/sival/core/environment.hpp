@@ -13,7 +13,7 @@ namespace SiVAL {
  * as implementations of resolver interfaces. A configured object of this class
  * is passed to library functions that need to access external resources.
  */
-class Environment
+class LIB_SIVAL_EXPORT Environment
 {
 public:
     // --- Constructor ---
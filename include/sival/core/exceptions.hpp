@@ -40,5 +40,12 @@ public:
         :Exception(msg, SiVAL::ErrorCode::FileAccessError) {
     }
 };
+
+class UnknownUnit : public Exception {
+public:
+    UnknownUnit(const std::string &msg)
+        : Exception(msg, SiVAL::ErrorCode::UnknownUnit) {
+    }
+};
 } // namespace Exception
 } // namespace SiVAL
@@ -0,0 +1,160 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/libsival.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL {
+/**
+ * @class FrequencyGrid
+ * @brief An immutable, strictly increasing set of frequencies shared by all batched calculations.
+ *
+ * @details Responses that are evaluated for many frequencies at once operate on a
+ * common grid instead of calling `AbstractResponse::response()` point by point.
+ * The grid stores the frequencies in Hertz and, alongside them, the angular
+ * frequencies \f$ \omega = 2 \pi f \f$, so that calculation kernels never have to
+ * recompute them. Both arrays are contiguous and can be processed with SIMD.
+ *
+ * Two grids compare equal if they contain exactly the same frequencies. Results
+ * that were calculated on equal grids can therefore be combined element by element.
+ */
+class LIB_SIVAL_EXPORT FrequencyGrid
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @enum Spacing
+     * @brief Describes how the points of the grid are distributed.
+     */
+    enum class Spacing {
+        Linear,       ///< Constant distance in Hertz between two points.
+        Logarithmic,  ///< Constant ratio between two points.
+        Custom        ///< Arbitrary, strictly increasing frequencies.
+    };
+
+    /**
+     * @brief Creates an empty grid.
+     */
+    FrequencyGrid();
+
+    /**
+     * @brief Creates a grid with the given range, number of points and spacing.
+     * @param fmin The lowest frequency in Hertz.
+     * @param fmax The highest frequency in Hertz.
+     * @param points The number of points (at least 2).
+     * @param spacing The distribution of the points (`Linear` or `Logarithmic`).
+     * @throws SiVAL::Exceptions::OutOfRange If the range or the number of points is invalid.
+     */
+    FrequencyGrid(double fmin, double fmax, std::size_t points, Spacing spacing = Spacing::Logarithmic);
+
+    /**
+     * @brief Creates a grid from arbitrary frequencies.
+     * @param frequencies The frequencies in Hertz. They must be positive and strictly increasing.
+     * @throws SiVAL::Exceptions::OutOfRange If the frequencies are not positive or not strictly increasing.
+     */
+    explicit FrequencyGrid(std::vector<double> frequencies);
+
+    /**
+     * @brief Creates a logarithmic grid with a fixed resolution per octave.
+     * @param fmin The lowest frequency in Hertz.
+     * @param fmax The highest frequency in Hertz (included if it lies on the grid).
+     * @param pointsPerOctave The number of points per octave.
+     * @return The logarithmically spaced grid.
+     */
+    static FrequencyGrid pointsPerOctave(double fmin, double fmax, std::size_t pointsPerOctave);
+
+    /**
+     * @brief Returns the frequency at the given index in Hertz.
+     */
+    double frequency(std::size_t index) const;
+
+    /**
+     * @brief Returns all frequencies in Hertz.
+     */
+    const std::vector<double>& frequencies() const;
+
+    /**
+     * @brief Returns all angular frequencies \f$ \omega = 2 \pi f \f$ in rad/s.
+     */
+    const std::vector<double>& omega() const;
+
+    /**
+     * @brief Returns true if the grid contains no frequencies.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the number of frequencies.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns the distribution of the points.
+     */
+    Spacing spacing() const;
+
+    /**
+     * @brief Two grids are equal if they contain exactly the same frequencies.
+     */
+    bool operator==(const FrequencyGrid &other) const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    void updateOmega();
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    std::vector<double> m_frequencies;
+    std::vector<double> m_omega;
+    Spacing m_spacing;
+    //// end private member
+};
+}
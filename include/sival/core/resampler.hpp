@@ -0,0 +1,174 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/core/frequencygrid.hpp>
+#include <sival/core/spectrum.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL {
+/**
+ * @class Resampler
+ * @brief Interpolates data from one frequency grid onto another.
+ *
+ * @details Every point of the target grid is a weighted sum of neighbouring points
+ * of the source grid. The interpolation runs over \f$ \log f \f$:
+ *
+ * - `Method::Linear` uses the two enclosing source points.
+ * - `Method::Cubic` uses the Lagrange polynomial through four source points
+ *   (two on each side, shifted inwards at the ends of the source grid). Grids
+ *   with fewer than four points fall back to linear interpolation.
+ *
+ * Outside of the source grid the first or last value is held.
+ *
+ * **Caching**
+ *
+ * The first source index and the weights of every target point depend only on
+ * the two grids. They are calculated once in the constructor and stored per tap
+ * as contiguous arrays, so `apply()` is a flat multiply-add loop without any
+ * search or logarithm that the compiler can vectorize. One resampler should be
+ * created per grid pair and reused for all curves on these grids.
+ *
+ * Complex data is interpolated by its real and imaginary part. For data with a
+ * large phase rotation between two source points (e.g. a long delay)
+ * `applyPolar()` with the unwrapped phase gives better results.
+ */
+class LIB_SIVAL_EXPORT Resampler
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @enum Method
+     * @brief The interpolation over \f$ \log f \f$.
+     */
+    enum class Method {
+        Linear,  ///< Two points, linear.
+        Cubic    ///< Four points, cubic Lagrange polynomial.
+    };
+
+    /**
+     * @brief Calculates the index mapping between two grids.
+     * @param source The grid of the input data (at least 2 points).
+     * @param target The grid of the output data.
+     * @param method The interpolation method.
+     * @throws SiVAL::Exceptions::OutOfRange If the source grid has fewer than two points.
+     */
+    Resampler(const SiVAL::FrequencyGrid &source, const SiVAL::FrequencyGrid &target,
+              Method method = Method::Linear);
+    /// Destructor
+    ~Resampler();
+
+    /**
+     * @brief Interpolates raw values.
+     * @param in `source().size()` values.
+     * @param out Receives `target().size()` values. Must not overlap with `in`.
+     */
+    void apply(const double* in, double* out) const;
+
+    /**
+     * @brief Interpolates real values.
+     * @param out Receives the values on the target grid. It is resized if necessary. May be the same object as `in`.
+     * @throws SiVAL::Exceptions::OutOfRange If the size does not match the source grid.
+     */
+    void apply(const std::vector<double> &in, std::vector<double> &out) const;
+
+    /**
+     * @brief Interpolates a complex response by its real and imaginary part.
+     * @param out Receives the response on the target grid. It is resized if necessary. May be the same object as `in`.
+     * @throws SiVAL::Exceptions::OutOfRange If the size does not match the source grid.
+     */
+    void apply(const SiVAL::Spectrum &in, SiVAL::Spectrum &out) const;
+
+    /**
+     * @brief Interpolates magnitude and phase separately.
+     * @details The phase is unwrapped before the interpolation, the result is not
+     * wrapped again. The magnitude is interpolated as given, so a level in dB is
+     * interpolated logarithmically and a linear magnitude linearly.
+     * @param magnitude The magnitude on the source grid.
+     * @param phase The phase on the source grid in radians.
+     * @param outMagnitude Receives the magnitude on the target grid. May be the same object as `magnitude`.
+     * @param outPhase Receives the unwrapped phase on the target grid in radians.
+     * @throws SiVAL::Exceptions::OutOfRange If a size does not match the source grid.
+     */
+    void applyPolar(const std::vector<double> &magnitude, const std::vector<double> &phase,
+                    std::vector<double> &outMagnitude, std::vector<double> &outPhase) const;
+
+    /**
+     * @brief Returns the interpolation method.
+     */
+    Method method() const;
+
+    /**
+     * @brief Returns the grid of the input data.
+     */
+    const SiVAL::FrequencyGrid& source() const;
+
+    /**
+     * @brief Returns the grid of the output data.
+     */
+    const SiVAL::FrequencyGrid& target() const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    void check(std::size_t size) const;
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    SiVAL::FrequencyGrid m_source;
+    SiVAL::FrequencyGrid m_target;
+    Method m_method;
+
+    // out[i] = sum_t m_weights[t * n + i] * in[m_index[i] + t], t < m_taps
+    std::size_t m_taps;
+    std::vector<std::size_t> m_index;
+    std::vector<double> m_weights;
+    //// end private member
+};
+}
@@ -2,6 +2,8 @@
 
 #include <memory>
 
+#include <sival/libsival.hpp>
+
 // Forward declaration to avoid including the full driver header
 namespace SiVAL {
 class AbstractDriver;
@@ -16,6 +18,15 @@ namespace SiVAL {
  * @details This class acts as a simple data container. Its purpose is to define
  * which driver model (`AbstractDriver`) is used and in what quantity (`count`)
  * for a logical position within a system.
+ *
+ * For the summation of several roles (`SiVAL::Response::Summation`) it also
+ * carries the alignment of the role: an additional signal delay, the acoustic
+ * offset of the radiating plane and the polarity.
+ *
+ * How the `count` drivers are connected is described by `wiring`. For
+ * `Wiring::SeriesParallel` the drivers are split into strings of `series`
+ * drivers each, so `count` must be a multiple of `series`. Isobaric and
+ * push-pull configurations are built from pairs and need an even `count`.
  */
 class LIB_SIVAL_EXPORT RoleConfig
 {
@@ -30,19 +41,58 @@ public:
      * @param d A `shared_ptr` to the driver model.
      * @param c The quantity of identical drivers of this model.
      */
-    RoleConfig(std::shared_ptr<AbstractDriver> d, int c = 1)
+    RoleConfig(std::shared_ptr<const AbstractDriver> d, int c = 1)
         : driver(d), count(c)
     {}
 
+    /**
+     * @brief Constructs a RoleConfig with a specific driver, count and wiring.
+     * @param d A `shared_ptr` to the driver model.
+     * @param c The quantity of identical drivers of this model.
+     * @param w The wiring of the drivers.
+     * @param s The number of drivers in series per string (only used for `Wiring::SeriesParallel`).
+     */
+    RoleConfig(std::shared_ptr<const AbstractDriver> d, int c, Wiring w, int s = 1)
+        : driver(d), count(c), wiring(w), series(s)
+    {}
+
     /**
      * @brief A `shared_ptr` that points to the driver model used for this role.
+     * @details The driver is read-only, so one instance can be shared by many setups (see `SiVAL::Driver::Cache`).
      */
-    std::shared_ptr<AbstractDriver> driver = nullptr;
+    std::shared_ptr<const AbstractDriver> driver = nullptr;
 
     /**
      * @brief The quantity of identical drivers of this model to be used for the role.
      */
     int count = 1;
+
+    /**
+     * @brief How the drivers of this role are connected.
+     */
+    Wiring wiring = Wiring::Parallel;
+
+    /**
+     * @brief The number of drivers connected in series per string for `Wiring::SeriesParallel`.
+     */
+    int series = 1;
+
+    /**
+     * @brief An additional signal delay for this role in seconds (e.g. from a DSP).
+     */
+    double delay = 0.0;
+
+    /**
+     * @brief The acoustic offset of the radiating plane in meters.
+     * @details Measured along the listening axis relative to the common reference
+     * plane. Positive values move the acoustic center away from the listener.
+     */
+    double offset = 0.0;
+
+    /**
+     * @brief Inverts the polarity of this role when set to true.
+     */
+    bool inverted = false;
 };
 
 } // namespace SiVAL
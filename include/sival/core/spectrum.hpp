@@ -0,0 +1,164 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <complex>
+#include <cstddef>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/libsival.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL {
+/**
+ * @class Spectrum
+ * @brief Complex frequency-domain data belonging to a `FrequencyGrid`.
+ *
+ * @details The values are stored as two separate, contiguous arrays for the real
+ * and the imaginary part (structure of arrays) instead of an array of
+ * `std::complex<double>`. This layout allows the compiler to process complex
+ * additions, multiplications and divisions with packed SIMD instructions,
+ * because consecutive frequencies lie next to each other in memory.
+ *
+ * A spectrum does not store its grid. The caller is responsible for only
+ * combining spectra that were calculated on the same grid.
+ */
+class LIB_SIVAL_EXPORT Spectrum
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @brief Creates an empty spectrum.
+     */
+    Spectrum();
+
+    /**
+     * @brief Creates a spectrum of the given size, initialized with zero.
+     * @param size The number of complex values.
+     */
+    explicit Spectrum(std::size_t size);
+
+    /**
+     * @brief Adds another spectrum element by element (`this += other`).
+     * @throws SiVAL::Exceptions::OutOfRange If the sizes differ.
+     */
+    void accumulate(const Spectrum &other);
+
+    /**
+     * @brief Returns the complex value at the given index.
+     */
+    std::complex<double> at(std::size_t index) const;
+
+    /**
+     * @brief Sets all values to the given complex number.
+     */
+    void fill(std::complex<double> value);
+
+    /**
+     * @brief Returns the imaginary parts.
+     */
+    double* imag();
+    const double* imag() const;
+
+    /**
+     * @brief Returns the magnitudes \f$ |H| \f$.
+     */
+    std::vector<double> magnitude() const;
+
+    /**
+     * @brief Returns the magnitudes as level in dB: \f$ 20 \log_{10}(|H| / ref) \f$.
+     * @param reference The reference value (e.g. `SiVAL::P_REF` for sound pressure).
+     */
+    std::vector<double> magnitudeDb(double reference = 1.0) const;
+
+    /**
+     * @brief Multiplies with another spectrum element by element (`this *= other`).
+     * @throws SiVAL::Exceptions::OutOfRange If the sizes differ.
+     */
+    void multiply(const Spectrum &other);
+
+    /**
+     * @brief Returns the phase angles in radians in the range \f$ [-\pi, \pi] \f$.
+     */
+    std::vector<double> phase() const;
+
+    /**
+     * @brief Returns the real parts.
+     */
+    double* real();
+    const double* real() const;
+
+    /**
+     * @brief Changes the number of values. New values are initialized with zero.
+     */
+    void resize(std::size_t size);
+
+    /**
+     * @brief Multiplies all values with a real factor.
+     */
+    void scale(double factor);
+
+    /**
+     * @brief Sets the complex value at the given index.
+     */
+    void set(std::size_t index, std::complex<double> value);
+
+    /**
+     * @brief Returns the number of complex values.
+     */
+    std::size_t size() const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    std::vector<double> m_real;
+    std::vector<double> m_imag;
+    //// end private member
+};
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <string>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/libsival.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL {
+/**
+ * @class VoiceCoil
+ * @brief The blocked impedance of the voice coil without its DC resistance.
+ *
+ * @details A single inductance \f$ j \omega L_e \f$ describes the impedance of a
+ * real voice coil only up to a few hundred Hertz: eddy currents in the pole
+ * piece make the real part rise and the imaginary part grow slower than
+ * \f$ \omega \f$. The models (\f$ Z_e = R_e + Z_{vc} \f$):
+ *
+ * | Model    | \f$ Z_{vc}(\omega) \f$                                                         | Parameters |
+ * | :------- | :----------------------------------------------------------------------------- | :--------- |
+ * | `Simple` | \f$ j \omega L_e \f$                                                           | `le` |
+ * | `LR2`    | \f$ j \omega L_e + \frac{R_2 \, j \omega L_2}{R_2 + j \omega L_2} \f$           | `le`, `r2`, `l2` |
+ * | `Wright` | \f$ K_{rm} \omega^{E_{rm}} + j K_{xm} \omega^{E_{xm}} \f$                      | `krm`, `erm`, `kxm`, `exm` |
+ * | `Leach`  | \f$ K (j \omega)^n = K \omega^n \left( \cos\frac{n \pi}{2} + j \sin\frac{n \pi}{2} \right) \f$ | `k`, `n` |
+ *
+ * In the driver JSON the model is an optional object in `electrical_parameters`,
+ * e.g. `"voice_coil": {"model": "LR2", "r2": {"value": 3.1, "unit": "Ohm"}, "l2": {"value": 0.0004, "unit": "H"}}`.
+ * `le` is always taken from `electrical_parameters`.
+ *
+ * `evaluate()` calculates \f$ Z_{vc} \f$ for a whole grid at once. The powers of
+ * the Wright and Leach models are expensive, so `SiVAL::Response::DriverModel`
+ * stores the result once per frequency grid.
+ */
+class LIB_SIVAL_EXPORT VoiceCoil
+{
+public:
+    /**
+     * @brief The model of the voice coil impedance.
+     */
+    enum class Model {
+        Simple = 0, ///< One inductance.
+        LR2,        ///< Inductance with a parallel R-L branch in series (semi-inductance).
+        Wright,     ///< Empirical power laws for the real and imaginary part.
+        Leach       ///< Lossy inductance \f$ K (j \omega)^n \f$.
+    };
+
+    /**
+     * @brief Default constructor: simple model without inductance.
+     */
+    VoiceCoil() = default;
+
+    /**
+     * @brief Calculates \f$ Z_{vc} \f$ and its derivatives \f$ p_k \, \partial Z_{vc} / \partial p_k \f$.
+     * @details Used by fits in logarithmic coordinates. The parameters are ordered as in `parameters()`.
+     * @param omega The angular frequency.
+     * @param real Receives the real part.
+     * @param imag Receives the imaginary part.
+     * @param dReal Receives `parameterCount()` derivatives of the real part.
+     * @param dImag Receives `parameterCount()` derivatives of the imaginary part.
+     */
+    void derivatives(double omega, double &real, double &imag, double* dReal, double* dImag) const;
+
+    /**
+     * @brief Calculates \f$ Z_{vc} \f$ for several angular frequencies.
+     * @param omega The angular frequencies.
+     * @param real Receives the real parts.
+     * @param imag Receives the imaginary parts.
+     * @param count The number of frequencies.
+     */
+    void evaluate(const double* omega, double* real, double* imag, std::size_t count) const;
+
+    /**
+     * @brief Returns the model for its name (`Simple`, `LR2`, `Wright`, `Leach`).
+     * @throws SiVAL::Exceptions::OutOfRange If the name is unknown.
+     */
+    static Model modelFromString(const std::string &name);
+
+    /**
+     * @brief Returns the name of a model.
+     */
+    static std::string modelToString(Model model);
+
+    /**
+     * @brief Returns the number of parameters of the model.
+     */
+    std::size_t parameterCount() const;
+
+    /**
+     * @brief Copies the parameters of the model into `values` (`parameterCount()` values).
+     */
+    void parameters(double* values) const;
+
+    /**
+     * @brief Returns a copy with all impedances multiplied by `factor` (e.g. for wiring).
+     */
+    VoiceCoil scaled(double factor) const;
+
+    /**
+     * @brief Sets the parameters of the model from `values` (`parameterCount()` values).
+     */
+    void setParameters(const double* values);
+
+    Model model = Model::Simple; ///< The model.
+    double le = 0.0;             ///< Inductance in H (`Simple`, `LR2`).
+    double r2 = 0.0;             ///< Resistance of the parallel branch in Ohm (`LR2`).
+    double l2 = 0.0;             ///< Inductance of the parallel branch in H (`LR2`).
+    double krm = 0.0;            ///< Factor of the real part (`Wright`).
+    double erm = 0.0;            ///< Exponent of the real part (`Wright`).
+    double kxm = 0.0;            ///< Factor of the imaginary part (`Wright`).
+    double exm = 0.0;            ///< Exponent of the imaginary part (`Wright`).
+    double k = 0.0;              ///< Factor (`Leach`).
+    double n = 0.0;              ///< Exponent between 0 (resistor) and 1 (inductance) (`Leach`).
+};
+}
@@ -0,0 +1,200 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/libsival.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Crossover {
+/**
+ * @struct Component
+ * @brief A single passive component of a crossover network.
+ *
+ * @details Real components are modelled with their equivalent series resistance (ESR).
+ * For an inductor this is the DC resistance of the winding, for a capacitor the
+ * loss resistance. The ESR of a resistor is simply added to its value.
+ *
+ * | Type        | Impedance                                     | Unit of `value` |
+ * | :---------- | :-------------------------------------------- | :-------------- |
+ * | `Inductor`  | \f$ R_{esr} + j \omega L \f$                  | Henry (H)       |
+ * | `Capacitor` | \f$ R_{esr} + \frac{1}{j \omega C} \f$        | Farad (F)       |
+ * | `Resistor`  | \f$ R + R_{esr} \f$                           | Ohm (Ω)         |
+ */
+struct Component {
+    /**
+     * @enum Type
+     * @brief The kind of the component.
+     */
+    enum class Type {
+        Inductor,
+        Capacitor,
+        Resistor
+    };
+
+    Type type = Type::Resistor;  ///< The kind of the component.
+    double value = 0.0;          ///< The nominal value in H, F or Ohm.
+    double esr = 0.0;            ///< The equivalent series resistance in Ohm.
+};
+
+/**
+ * @struct Branch
+ * @brief One stage of a ladder network, made of one or more components.
+ *
+ * @details A branch is either placed in the signal path (`Placement::Series`) or
+ * from the signal path to ground (`Placement::Shunt`). If it contains more than
+ * one component, they are combined in series (e.g. a Zobel network R + C) or in
+ * parallel (e.g. a notch filter L || C || R).
+ */
+struct Branch {
+    /**
+     * @enum Placement
+     * @brief Position of the branch within the ladder.
+     */
+    enum class Placement {
+        Series,
+        Shunt
+    };
+
+    /**
+     * @enum Combination
+     * @brief How the components of the branch are connected to each other.
+     */
+    enum class Combination {
+        Series,
+        Parallel
+    };
+
+    Placement placement = Placement::Series;      ///< Position within the ladder.
+    Combination combination = Combination::Series; ///< Connection of the components.
+    std::vector<Component> components;            ///< The components of the branch.
+};
+
+/**
+ * @class Network
+ * @brief Describes a passive ladder network between amplifier and driver of one role.
+ *
+ * @details The branches are ordered from the amplifier terminals towards the driver.
+ * The topology (number, placement and combination of the branches) is fixed once
+ * the network has been handed to a `Solver`. The component values, however, can be
+ * changed at any time through a flat index, which is what optimization loops use.
+ *
+ * Example of a second order low pass (series inductor, shunt capacitor):
+ * @code
+ * SiVAL::Crossover::Network lowPass;
+ * lowPass.addSeries({Component::Type::Inductor, 1.5e-3, 0.3})
+ *        .addShunt({Component::Type::Capacitor, 22e-6});
+ * @endcode
+ */
+class LIB_SIVAL_EXPORT Network
+{
+
+    //// begin public member methods
+public:
+    /// Constructor
+    Network();
+    /// Destructor
+    ~Network();
+
+    /**
+     * @brief Appends a branch at the driver side of the network.
+     * @throws SiVAL::Exceptions::OutOfRange If the branch contains no component.
+     */
+    Network& addBranch(Branch branch);
+
+    /**
+     * @brief Appends a single component in the signal path.
+     */
+    Network& addSeries(Component component);
+
+    /**
+     * @brief Appends a single component from the signal path to ground.
+     */
+    Network& addShunt(Component component);
+
+    /**
+     * @brief Returns all branches, ordered from the amplifier to the driver.
+     */
+    const std::vector<Branch>& branches() const;
+
+    /**
+     * @brief Returns the component with the given flat index.
+     * @details Components are numbered in the order of their branches and, within a branch, in the order of insertion.
+     * @throws SiVAL::Exceptions::OutOfRange If the index is invalid.
+     */
+    const Component& component(std::size_t index) const;
+
+    /**
+     * @brief Returns the total number of components.
+     */
+    std::size_t componentCount() const;
+
+    /**
+     * @brief Returns true if the network contains no branch. The driver is then connected directly.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Changes the value of a component.
+     * @param index The flat index of the component.
+     * @param value The new value in H, F or Ohm.
+     * @throws SiVAL::Exceptions::OutOfRange If the index is invalid.
+     */
+    void setValue(std::size_t index, double value);
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    Component& locate(std::size_t index);
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    std::vector<Branch> m_branches;
+    std::size_t m_componentCount;
+    //// end private member
+};
+}
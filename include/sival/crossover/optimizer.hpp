@@ -0,0 +1,215 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/core/spectrum.hpp>
+#include <sival/crossover/solver.hpp>
+#include <sival/libsival.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+namespace SiVAL::Response {
+class Summation;
+}
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Crossover {
+/**
+ * @class Optimizer
+ * @brief Tunes crossover component values so that the summed response matches a target.
+ *
+ * @details The optimizer minimizes the cost function
+ *
+ * \f[ J = \frac{1}{N} \sum_i w_i \left( L_i - T_i \right)^2
+ *       + \frac{\lambda}{N} \sum_i \max\left(0, Z_{min} - |Z_{sys,i}|\right)^2 \f]
+ *
+ * where \f$ L_i \f$ is the summed SPL in dB, \f$ T_i \f$ the target, \f$ w_i \f$ optional
+ * weights, \f$ Z_{min} \f$ the impedance floor and \f$ \lambda \f$ its weight.
+ *
+ * **Search**
+ *
+ * The free component values are optimized in logarithmic coordinates, which keeps
+ * them positive and gives all parameters a comparable scale. A local search uses
+ * a quasi-Newton method (BFGS) with projected Armijo line search. Its gradient
+ * is taken by central differences, because a single cost evaluation is cheap:
+ * changing one component only re-solves the network of that component's role.
+ *
+ * The global phase runs several local searches from different starting points
+ * in parallel. The first start always uses the current component values of the
+ * crossover, the others are drawn uniformly within the bounds. Each worker
+ * thread owns a copy of the `Solver` and all buffers, so no synchronization is
+ * needed during the search.
+ *
+ * **Reuse of the driver responses**
+ *
+ * Upon construction the aligned pressure of every role is copied once from a
+ * prepared `Response::Summation`. The driver models are never evaluated again.
+ */
+class LIB_SIVAL_EXPORT Optimizer
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @struct Parameter
+     * @brief A component value that is free to be changed.
+     */
+    struct Parameter {
+        SiVAL::DriverRole role;  ///< The role of the network.
+        std::size_t index;       ///< The flat component index within the network.
+        double minimum;          ///< The lower bound in H, F or Ohm (> 0).
+        double maximum;          ///< The upper bound in H, F or Ohm.
+    };
+
+    /**
+     * @struct Settings
+     * @brief Controls the search.
+     */
+    struct Settings {
+        std::size_t starts = 16;        ///< Number of local searches in the global phase.
+        std::size_t iterations = 200;   ///< Maximum number of BFGS iterations per start.
+        std::size_t threads = 0;        ///< Number of threads, 0 selects all hardware threads.
+        double tolerance = 1e-9;        ///< Relative change of the cost at which a search stops.
+        unsigned int seed = 1;          ///< Seed for the random starting points.
+    };
+
+    /**
+     * @struct Result
+     * @brief The best solution found.
+     */
+    struct Result {
+        std::vector<double> values;     ///< The component values in the order of the parameters.
+        double cost = 0.0;              ///< The cost of the solution.
+        std::size_t iterations = 0;     ///< BFGS iterations of the best start.
+        std::size_t evaluations = 0;    ///< Cost evaluations of all starts.
+    };
+
+    /**
+     * @brief Creates an optimizer for a crossover and a prepared summation.
+     * @param summation A summation whose role responses were prepared on the grid of the crossover.
+     * @param crossover The crossover with networks and loads. It is copied.
+     * @throws SiVAL::Exceptions::OutOfRange If the grids or the source resistances differ.
+     */
+    Optimizer(const SiVAL::Response::Summation &summation, const Solver &crossover);
+    /// Destructor
+    ~Optimizer();
+
+    /**
+     * @brief Adds a component that is free to be changed.
+     * @throws SiVAL::Exceptions::OutOfRange If the component does not exist or the bounds are invalid.
+     */
+    void addParameter(SiVAL::DriverRole role, std::size_t index, double minimum, double maximum);
+
+    /**
+     * @brief Writes the values of a result into a crossover.
+     */
+    void apply(const Result &result, Solver &crossover) const;
+
+    /**
+     * @brief Calculates the cost for the given component values.
+     * @param values One value per parameter in H, F or Ohm.
+     */
+    double cost(const std::vector<double> &values) const;
+
+    /**
+     * @brief Runs the multi-start optimization with default settings.
+     * @throws SiVAL::Exceptions::OutOfRange If no parameter or no target is set.
+     */
+    Result optimize() const;
+    /**
+     * @brief Runs the multi-start optimization.
+     * @throws SiVAL::Exceptions::OutOfRange If no parameter or no target is set.
+     */
+    Result optimize(const Settings &settings) const;
+
+    /**
+     * @brief Returns the free parameters.
+     */
+    const std::vector<Parameter>& parameters() const;
+
+    /**
+     * @brief Sets the minimum allowed magnitude of the system impedance.
+     * @param ohm The impedance floor in Ohm, 0 disables the penalty.
+     * @param weight The weight \f$ \lambda \f$ of the penalty.
+     */
+    void setImpedanceFloor(double ohm, double weight = 1.0);
+
+    /**
+     * @brief Sets the target response.
+     * @param spl The target SPL in dB, one value per grid point.
+     * @param weights Optional weights per grid point. Empty means equal weights.
+     * @throws SiVAL::Exceptions::OutOfRange If the sizes do not match the grid.
+     */
+    void setTarget(std::vector<double> spl, std::vector<double> weights = {});
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    struct Workspace;
+    double evaluate(Workspace &workspace, const std::vector<double> &x) const;
+    void gradient(Workspace &workspace, const std::vector<double> &x, double fx, std::vector<double> &g) const;
+    Result search(Workspace &workspace, std::vector<double> x, const Settings &settings) const;
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    /**
+     * @brief The cached pressure of a role that is filtered by the crossover.
+     */
+    struct FilteredRole {
+        SiVAL::DriverRole role;
+        SiVAL::Spectrum pressure;
+    };
+
+    Solver m_crossover;
+    std::vector<FilteredRole> m_filtered;
+    SiVAL::Spectrum m_unfiltered;
+    std::vector<Parameter> m_parameters;
+    std::vector<double> m_target;
+    std::vector<double> m_weights;
+    double m_impedanceFloor;
+    double m_impedanceWeight;
+    //// end private member
+};
+}
@@ -0,0 +1,234 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <map>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/core/frequencygrid.hpp>
+#include <sival/core/spectrum.hpp>
+#include <sival/crossover/network.hpp>
+#include <sival/libsival.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+namespace SiVAL::Response {
+class DriverModel;
+}
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Crossover {
+/**
+ * @class Solver
+ * @brief Solves the passive crossover networks of all roles against the frequency-dependent driver impedances.
+ *
+ * @details Each role consists of a `Network` and the impedance of its driver (the
+ * load). All networks are connected to the same amplifier terminals. For every
+ * role the solver calculates
+ * - the voltage transfer \f$ H(\omega) = U_{driver} / U_{amp} \f$ and
+ * - the input impedance \f$ Z_{in}(\omega) \f$ of the network terminated by the driver,
+ *
+ * and from these the total impedance of the system
+ * \f$ Z_{sys} = \left( \sum_k Z_{in,k}^{-1} \right)^{-1} \f$.
+ *
+ * **Solving a ladder network**
+ *
+ * The ladder is walked from the driver back to the amplifier, starting with
+ * \f$ U = 1 \f$ and \f$ I = Y_{load} \f$. A branch in the signal path adds its
+ * voltage drop (\f$ U \mathrel{+}= I \cdot Z \f$), a branch to ground adds its
+ * current (\f$ I \mathrel{+}= U \cdot Y \f$). At the amplifier the transfer is
+ * \f$ H = 1 / U \f$ and the input impedance \f$ Z_{in} = U / I \f$. All steps
+ * work on whole arrays over the frequency grid.
+ *
+ * **Source resistance**
+ *
+ * The series resistance \f$ R_g \f$ of amplifier and cable
+ * (`setSourceResistance()`) is shared by all roles. It forms a divider with the
+ * system impedance, so every transfer is multiplied with
+ *
+ * \f[ D = \frac{Z_{sys}}{Z_{sys} + R_g} = \frac{1}{1 + R_g Y_{sys}} \f]
+ *
+ * and \f$ H \f$ becomes the transfer from the open circuit voltage of the source
+ * to the driver. The impedances stay the ones seen at the amplifier terminals.
+ *
+ * **Reuse between solves**
+ *
+ * Everything that does not depend on the component values is prepared once: the
+ * admittance of each load, \f$ 1/\omega \f$ of the grid and all work buffers.
+ * Changing a value with `setComponentValue()` only marks the role as modified, and
+ * `solve()` recalculates just the modified roles without any allocation. This keeps
+ * optimization loops that vary component values fast.
+ */
+class LIB_SIVAL_EXPORT Solver
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @brief Creates a solver for the given grid.
+     * @param grid The frequencies at which all networks are solved.
+     */
+    explicit Solver(const SiVAL::FrequencyGrid &grid);
+    /// Destructor
+    ~Solver();
+
+    /**
+     * @brief Returns true if the role has a load.
+     */
+    bool contains(SiVAL::DriverRole role) const;
+
+    /**
+     * @brief Returns the frequency grid.
+     */
+    const SiVAL::FrequencyGrid& grid() const;
+
+    /**
+     * @brief Returns the input impedance of a role's network terminated by its driver in Ohm.
+     * @throws SiVAL::Exceptions::OutOfRange If the role is unknown.
+     */
+    const SiVAL::Spectrum& inputImpedance(SiVAL::DriverRole role) const;
+
+    /**
+     * @brief Returns the network of a role.
+     * @throws SiVAL::Exceptions::OutOfRange If the role is unknown.
+     */
+    const Network& network(SiVAL::DriverRole role) const;
+
+    /**
+     * @brief Returns all roles known to the solver.
+     */
+    std::vector<SiVAL::DriverRole> roles() const;
+
+    /**
+     * @brief Changes the value of a component and marks the role for recalculation.
+     * @param role The role whose network is modified.
+     * @param index The flat index of the component within the network.
+     * @param value The new value in H, F or Ohm.
+     * @throws SiVAL::Exceptions::OutOfRange If the role or the index is unknown.
+     */
+    void setComponentValue(SiVAL::DriverRole role, std::size_t index, double value);
+
+    /**
+     * @brief Sets the impedance of the driver of a role.
+     * @param role The role of the driver.
+     * @param impedance The complex impedance in Ohm on the grid of the solver.
+     * @throws SiVAL::Exceptions::OutOfRange If the size does not match the grid.
+     */
+    void setLoad(SiVAL::DriverRole role, const SiVAL::Spectrum &impedance);
+
+    /**
+     * @brief Sets the impedance of the driver of a role from its driver model.
+     * @details Also takes over the series resistance of the model's drive source
+     * (`DriverModel::Coefficients::rg`) as source resistance of the solver.
+     */
+    void setLoad(SiVAL::DriverRole role, const SiVAL::Response::DriverModel &model);
+
+    /**
+     * @brief Sets the network in front of the driver of a role.
+     * @details A role without network is connected directly to the amplifier.
+     */
+    void setNetwork(SiVAL::DriverRole role, Network network);
+
+    /**
+     * @brief Sets the series resistance of amplifier and cable in Ohm (default 0).
+     */
+    void setSourceResistance(double resistance);
+
+    /**
+     * @brief Returns the series resistance of amplifier and cable in Ohm.
+     */
+    double sourceResistance() const;
+
+    /**
+     * @brief Solves all roles whose network or load was modified since the last call.
+     * @throws SiVAL::Exceptions::OutOfRange If a role has a network but no load.
+     */
+    void solve();
+
+    /**
+     * @brief Returns the total impedance of all roles in parallel in Ohm (without the source resistance).
+     */
+    const SiVAL::Spectrum& systemImpedance() const;
+
+    /**
+     * @brief Returns the voltage transfer from the source to the driver of a role, including the source resistance.
+     * @throws SiVAL::Exceptions::OutOfRange If the role is unknown.
+     */
+    const SiVAL::Spectrum& transfer(SiVAL::DriverRole role) const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    struct Role;
+    Role& entry(SiVAL::DriverRole role);
+    const Role& entry(SiVAL::DriverRole role) const;
+    void solveRole(Role &role);
+    void updateSystemImpedance();
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    /**
+     * @brief Network, cached load and results of one role.
+     */
+    struct Role {
+        Network network;
+        bool hasLoad = false;
+        bool modified = true;
+        SiVAL::Spectrum load;
+        SiVAL::Spectrum loadAdmittance;
+        SiVAL::Spectrum voltage;
+        SiVAL::Spectrum current;
+        SiVAL::Spectrum branch;
+        SiVAL::Spectrum ladder;   ///< Transfer of the network alone.
+        SiVAL::Spectrum transfer; ///< Transfer including the source resistance.
+        SiVAL::Spectrum input;
+    };
+
+    SiVAL::FrequencyGrid m_grid;
+    std::vector<double> m_inverseOmega;
+    std::map<SiVAL::DriverRole, Role> m_roles;
+    SiVAL::Spectrum m_systemImpedance;
+    double m_sourceResistance;
+    bool m_sourceModified;
+    //// end private member
+};
+}
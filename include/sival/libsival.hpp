@@ -87,6 +87,15 @@ namespace Driver{}
  * across the entire codebase.
  */
 namespace Utils{}
+/**
+ * @namespace SiVAL::Crossover
+ * @brief **Passive Crossover Networks**
+ *
+ * This namespace describes passive networks of inductors, capacitors and resistors
+ * between the amplifier and the drivers of a multi-way system, and solves them
+ * against the frequency-dependent impedance of each driver.
+ */
+namespace Crossover{}
 
 
 /**
@@ -143,6 +152,12 @@ inline constexpr double RHO0 = 1.204;
      */
 inline constexpr double C_SOUND = 343.0;
 
+/**
+     * @brief Reference sound pressure (p_ref) for SPL values (0 dB).
+     * @unit Pa
+     */
+inline constexpr double P_REF = 2.0e-5;
+
 
 enum class EnclosureType {
     Sealed = 0,
@@ -151,12 +166,26 @@ enum class EnclosureType {
 
 enum class ErrorCode {
     OutOfRange,
-    FileAccessError
+    FileAccessError,
+    UnknownUnit
 };
 
 enum class ResponseType {
     Spl = 0,
-    Impedance
+    Impedance,
+    SystemSpl
+};
+
+/**
+ * @enum Wiring
+ * @brief Defines how several identical drivers of a role are connected.
+ */
+enum class Wiring {
+    Parallel = 0,   ///< All drivers electrically in parallel.
+    Series,         ///< All drivers electrically in series.
+    SeriesParallel, ///< Parallel strings of drivers in series.
+    Isobaric,       ///< Pairs of drivers coupled by a trapped air volume, electrically in parallel.
+    PushPull        ///< Pairs of drivers mounted face to face with inverted polarity, electrically in parallel.
 };
 
 
@@ -194,9 +223,30 @@ inline std::string roleToString(DriverRole role) {
     return "unknown";
 }
 
+/**
+ * @brief Converts a Wiring value to its corresponding string representation.
+ */
+inline std::string wiringToString(Wiring wiring) {
+    static const std::map<Wiring, std::string> wiringMap = {
+        {Wiring::Parallel,       "Parallel"},
+        {Wiring::Series,         "Series"},
+        {Wiring::SeriesParallel, "SeriesParallel"},
+        {Wiring::Isobaric,       "Isobaric"},
+        {Wiring::PushPull,       "PushPull"}
+    };
+
+    auto it = wiringMap.find(wiring);
+    if (it != wiringMap.end()) {
+        return it->second;
+    }
+    return "unknown";
+}
+
 inline std::string typeToString(ResponseType type) {
     static const std::map<ResponseType, std::string> typeMap = {
-        {ResponseType::Spl, "Spl"}
+        {ResponseType::Spl, "Spl"},
+        {ResponseType::Impedance, "Impedance"},
+        {ResponseType::SystemSpl, "SystemSpl"}
     };
 
     auto it = typeMap.find(type);
@@ -0,0 +1,163 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/core/frequencygrid.hpp>
+#include <sival/core/spectrum.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Response {
+/**
+ * @class Smoothing
+ * @ingroup Response
+ * @brief 1/N-octave smoothing of responses on a frequency grid.
+ *
+ * @details The smoothed value at \f$ f_i \f$ is the mean over all grid points in
+ * the band \f$ \left[ f_i \cdot 2^{-1/(2N)}, \; f_i \cdot 2^{1/(2N)} \right] \f$.
+ * On a logarithmic grid this is a rectangular window of constant width on the
+ * logarithmic frequency axis.
+ *
+ * - `power()` averages \f$ |H|^2 \f$ and returns \f$ \sqrt{\overline{|H|^2}} \f$.
+ *   The phase is lost; this is the usual smoothing for SPL curves.
+ * - `complex()` averages the real and the imaginary part separately and keeps
+ *   the phase information (e.g. for a following summation).
+ * - `average()` averages arbitrary real values (dB curves, group delay, ...).
+ *
+ * **Caching**
+ *
+ * The band limits of every grid point are found once in the constructor. Each
+ * call builds the prefix sums \f$ S_k = \sum_{j<k} x_j \f$ and takes the mean of a
+ * band as \f$ (S_{hi} - S_{lo}) / (hi - lo) \f$, so the cost is \f$ O(N) \f$ for any
+ * smoothing width. Because the prefix sums are complete before the first result
+ * is written, all methods also work in place.
+ */
+class LIB_SIVAL_EXPORT Smoothing
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @brief Prepares the band limits for a frequency grid.
+     * @param grid The frequency grid of the responses to smooth.
+     * @param fraction The denominator \f$ N \f$ of the band width 1/N octave (e.g. 3, 6, 12, 24).
+     * @throws SiVAL::Exceptions::OutOfRange If the fraction is not positive.
+     */
+    Smoothing(const SiVAL::FrequencyGrid &grid, double fraction);
+    /// Destructor
+    ~Smoothing();
+
+    /**
+     * @brief Smooths real values.
+     * @param values One value per grid point. `out` may be the same vector.
+     * @param out Receives the smoothed values. It is resized if necessary.
+     * @throws SiVAL::Exceptions::OutOfRange If the size does not match the grid.
+     */
+    void average(const std::vector<double> &values, std::vector<double> &out) const;
+
+    /**
+     * @brief Smooths real values in place.
+     * @throws SiVAL::Exceptions::OutOfRange If the size does not match the grid.
+     */
+    void average(std::vector<double> &values) const;
+
+    /**
+     * @brief Smooths the real and the imaginary part of a response.
+     * @param response One value per grid point. `out` may be the same spectrum.
+     * @param out Receives the smoothed response. It is resized if necessary.
+     * @throws SiVAL::Exceptions::OutOfRange If the size does not match the grid.
+     */
+    void complex(const SiVAL::Spectrum &response, SiVAL::Spectrum &out) const;
+
+    /**
+     * @brief Smooths the real and the imaginary part of a response in place.
+     * @throws SiVAL::Exceptions::OutOfRange If the size does not match the grid.
+     */
+    void complex(SiVAL::Spectrum &response) const;
+
+    /**
+     * @brief Returns the denominator \f$ N \f$ of the band width.
+     */
+    double fraction() const;
+
+    /**
+     * @brief Returns the frequency grid.
+     */
+    const SiVAL::FrequencyGrid& grid() const;
+
+    /**
+     * @brief Smooths the power of a response.
+     * @param response One value per grid point.
+     * @param magnitude Receives \f$ \sqrt{\overline{|H|^2}} \f$. It is resized if necessary.
+     * @throws SiVAL::Exceptions::OutOfRange If the size does not match the grid.
+     */
+    void power(const SiVAL::Spectrum &response, std::vector<double> &magnitude) const;
+
+    /**
+     * @brief Smooths the power of magnitudes \f$ |H| \f$ in place.
+     * @throws SiVAL::Exceptions::OutOfRange If the size does not match the grid.
+     */
+    void power(std::vector<double> &magnitude) const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    void check(std::size_t size) const;
+    void smooth(const double* values, double* out, std::vector<double> &prefix) const;
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    SiVAL::FrequencyGrid m_grid;
+    double m_fraction;
+
+    // Band [m_lower[i], m_upper[i]) of every grid point and 1 / (upper - lower)
+    std::vector<std::size_t> m_lower;
+    std::vector<std::size_t> m_upper;
+    std::vector<double> m_inverseCount;
+    //// end private member
+};
+}
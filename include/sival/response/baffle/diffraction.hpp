@@ -0,0 +1,185 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/core/frequencygrid.hpp>
+#include <sival/core/spectrum.hpp>
+#include <sival/libsival.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+namespace SiVAL {
+class AbstractEnclosure;
+}
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Response {
+/**
+ * @class Diffraction
+ * @ingroup Response
+ * @brief Edge diffraction of a rectangular baffle with discrete edge sources.
+ *
+ * @details The driver is a point source on the baffle. When the wave reaches an
+ * edge, the radiation changes from half space to full space. Following the
+ * simplified model of Vanderkooy, every edge point \f$ k \f$ acts as a secondary
+ * source of the strength \f$ -\frac{1}{2} w_k \f$ with the weight
+ *
+ * \f[ w_k = \frac{1}{2 \pi} \frac{\vec{n}_k \cdot (\vec{e}_k - \vec{s})}{|\vec{e}_k - \vec{s}|^2} \Delta s_k \f]
+ *
+ * which is the angle that the edge element \f$ \Delta s_k \f$ with the outward
+ * normal \f$ \vec{n}_k \f$ covers, seen from the driver \f$ \vec{s} \f$. The
+ * weights add up to 1, so at low frequencies the response drops by 6 dB (the
+ * baffle step). Relative to the direct sound on the driver axis at the distance
+ * \f$ R \f$ the transfer function is
+ *
+ * \f[ H(\omega) = 1 - \frac{1}{2} \sum_k w_k \frac{R}{l_k} e^{-j \omega \tau_k}
+ *     \qquad \tau_k = \frac{d_k + l_k - R}{c} \f]
+ *
+ * with the path \f$ d_k \f$ from the driver to the edge point and the path
+ * \f$ l_k = \sqrt{d_k^2 + R^2} \f$ from the edge point to the listener. For a
+ * listener in the far field (\f$ R = 0 \f$) the amplitude factor is 1 and
+ * \f$ \tau_k = d_k / c \f$.
+ *
+ * **Precomputation**
+ *
+ * The edge points, their normals and lengths only depend on the baffle and are
+ * created once in the constructor. `setDriver()` recalculates only the weights
+ * and delays, which is \f$ O(K) \f$ for \f$ K \f$ edge points, so driver position
+ * sweeps are cheap. `evaluate()` then sums the edge sources in flat loops over
+ * the grid.
+ */
+class LIB_SIVAL_EXPORT Diffraction
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @brief Creates the edge points of a rectangular baffle.
+     * @param width The width of the baffle in meters.
+     * @param height The height of the baffle in meters.
+     * @param spacing The maximum distance between two edge points in meters.
+     * @param speedOfSound The speed of sound in m/s.
+     * @throws SiVAL::Exceptions::OutOfRange If the size or the spacing is not positive.
+     */
+    Diffraction(double width, double height, double spacing = 0.005, double speedOfSound = SiVAL::C_SOUND);
+    /**
+     * @brief Creates the edge points for the baffle of an enclosure.
+     * @throws SiVAL::Exceptions::OutOfRange If the enclosure has no baffle.
+     */
+    explicit Diffraction(const SiVAL::AbstractEnclosure &enclosure, double spacing = 0.005,
+                         double speedOfSound = SiVAL::C_SOUND);
+    /// Destructor
+    ~Diffraction();
+
+    /**
+     * @brief Returns the number of edge points.
+     */
+    std::size_t edgePoints() const;
+
+    /**
+     * @brief Calculates the transfer function relative to half space radiation.
+     * @param grid The frequencies to evaluate.
+     * @param out Receives one value per grid point. It is resized if necessary.
+     */
+    void evaluate(const SiVAL::FrequencyGrid &grid, SiVAL::Spectrum &out) const;
+
+    /**
+     * @brief Returns the height of the baffle in meters.
+     */
+    double height() const;
+
+    /**
+     * @brief Moves the driver and recalculates the weights and delays of the edge points.
+     * @param x The horizontal position in meters from the left edge.
+     * @param y The vertical position in meters from the lower edge.
+     * @throws SiVAL::Exceptions::OutOfRange If the position is not inside of the baffle.
+     */
+    void setDriver(double x, double y);
+
+    /**
+     * @brief Moves the driver to the position of a role on the baffle of an enclosure.
+     */
+    void setDriver(const SiVAL::AbstractEnclosure &enclosure, SiVAL::DriverRole role);
+
+    /**
+     * @brief Sets the listening distance on the driver axis.
+     * @param distance The distance in meters, 0 selects the far field (default).
+     */
+    void setListenerDistance(double distance);
+
+    /**
+     * @brief Returns the width of the baffle in meters.
+     */
+    double width() const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    void addEdge(double x0, double y0, double x1, double y1, double nx, double ny);
+    void updatePaths();
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    double m_width;
+    double m_height;
+    double m_spacing;
+    double m_speedOfSound;
+    double m_distance;
+    double m_driverX;
+    double m_driverY;
+
+    // Geometry of the edge points (depends on the baffle only)
+    std::vector<double> m_edgeX;
+    std::vector<double> m_edgeY;
+    std::vector<double> m_normalX;
+    std::vector<double> m_normalY;
+    std::vector<double> m_length;
+
+    // Per driver position
+    std::vector<double> m_amplitude;
+    std::vector<double> m_delay;
+    //// end private member
+};
+}
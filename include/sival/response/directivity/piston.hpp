@@ -0,0 +1,102 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+//// end system includes
+
+//// begin project specific includes
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Response {
+/**
+ * @class Piston
+ * @ingroup Response
+ * @brief Far-field directivity of a rigid circular piston in an infinite baffle.
+ *
+ * @details The pressure of the piston at the angle \f$ \theta \f$ relative to the
+ * on-axis pressure is
+ *
+ * \f[ D(\theta) = \frac{2 J_1(x)}{x} \qquad x = k a \sin\theta \f]
+ *
+ * with the wave number \f$ k = \omega / c \f$, the piston radius \f$ a \f$ and the
+ * Bessel function of the first kind and first order \f$ J_1 \f$.
+ *
+ * **Cached table**
+ *
+ * Evaluating \f$ J_1 \f$ for every angle and frequency is expensive. \f$ D(x) \f$
+ * is therefore tabulated once per process on a uniform grid of \f$ x \f$ (step
+ * 1/32 up to \f$ x = 256 \f$) and linearly interpolated. The interpolation error
+ * is below \f$ 10^{-4} \f$. Beyond the table the asymptotic expansion
+ * \f$ J_1(x) \approx \sqrt{2 / (\pi x)} \cos(x - 3\pi/4) \f$ is used. The table is
+ * built on first use and is safe to use from several threads.
+ */
+class LIB_SIVAL_EXPORT Piston
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @brief Returns \f$ 2 J_1(x) / x \f$ from the cached table.
+     * @param x The argument \f$ k a \sin\theta \f$ (the sign is ignored).
+     */
+    static double directivity(double x);
+
+    /**
+     * @brief Calculates \f$ D(ka_i \cdot s) \f$ for a whole frequency row.
+     * @param ka The product \f$ k a \f$ per frequency.
+     * @param sine The value \f$ |\sin\theta| \f$ of the angle.
+     * @param out Receives `n` values.
+     * @param n The number of frequencies.
+     */
+    static void directivity(const double* ka, double sine, double* out, std::size_t n);
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    //// end private member
+};
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/core/frequencygrid.hpp>
+#include <sival/core/spectrum.hpp>
+#include <sival/libsival.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+namespace SiVAL {
+class AbstractDriver;
+}
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Response {
+/**
+ * @class PolarResponse
+ * @ingroup Response
+ * @brief Off-axis directivity of a driver over an angle × frequency grid.
+ *
+ * @details The driver is modelled as a baffled piston (`Piston`) with the radius
+ * derived from `AbstractDriver::effectiveDiameter()` or, if that is not given,
+ * from \f$ a = \sqrt{S_d / \pi} \f$. The angle \f$ \theta \f$ is measured from
+ * the driver axis in degrees. The piston radiates into the half space in front
+ * of the baffle, so the directivity is 0 for \f$ 90° < \theta < 270° \f$.
+ *
+ * `evaluate()` stores the real directivity factor \f$ D(\theta, f) \f$ in one
+ * contiguous array with one row per angle. The products \f$ k a \f$ are
+ * calculated once per frequency, a row then only needs one table lookup per
+ * frequency. The off-axis pressure is the on-axis pressure of
+ * `DriverModel::pressure()` multiplied with a row (`apply()`).
+ */
+class LIB_SIVAL_EXPORT PolarResponse
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @brief Creates a polar response for a piston of the given radius.
+     * @param radius The piston radius in meters.
+     * @param speedOfSound The speed of sound in m/s.
+     * @throws SiVAL::Exceptions::OutOfRange If the radius is not positive.
+     */
+    explicit PolarResponse(double radius, double speedOfSound = SiVAL::C_SOUND);
+    /**
+     * @brief Creates a polar response for the radiating area of a driver.
+     * @throws SiVAL::Exceptions::OutOfRange If the driver has neither an effective diameter nor Sd.
+     */
+    explicit PolarResponse(const SiVAL::AbstractDriver &driver, double speedOfSound = SiVAL::C_SOUND);
+    /// Destructor
+    ~PolarResponse();
+
+    /**
+     * @brief Returns `count` equally spaced angles in degrees from 0° to below 360°.
+     * @details 72 angles give the usual 5° resolution of a polar plot.
+     */
+    static std::vector<double> equalAngles(std::size_t count);
+
+    /**
+     * @brief Returns the angles of the last `evaluate()` in degrees.
+     */
+    const std::vector<double>& angles() const;
+
+    /**
+     * @brief Calculates the off-axis pressure for one angle.
+     * @param angle The index of the angle.
+     * @param onAxis The on-axis pressure on the grid of the polar response.
+     * @param out Receives the off-axis pressure. It is resized if necessary.
+     * @throws SiVAL::Exceptions::OutOfRange If the index or the size does not match.
+     */
+    void apply(std::size_t angle, const SiVAL::Spectrum &onAxis, SiVAL::Spectrum &out) const;
+
+    /**
+     * @brief Returns the directivity factor at one grid point.
+     * @param angle The index of the angle.
+     * @param frequency The index of the frequency.
+     */
+    double at(std::size_t angle, std::size_t frequency) const;
+
+    /**
+     * @brief Calculates the directivity for all angles and frequencies.
+     * @param grid The frequencies.
+     * @param angles The angles in degrees.
+     */
+    void evaluate(const SiVAL::FrequencyGrid &grid, const std::vector<double> &angles);
+
+    /**
+     * @brief Returns the frequency grid of the last `evaluate()`.
+     */
+    const SiVAL::FrequencyGrid& grid() const;
+
+    /**
+     * @brief Returns the level relative to on-axis in dB for one angle.
+     * @details Zeros of the directivity are limited to -200 dB.
+     */
+    std::vector<double> levelDb(std::size_t angle) const;
+
+    /**
+     * @brief Returns the piston radius in meters.
+     */
+    double radius() const;
+
+    /**
+     * @brief Returns the directivity of one angle for all frequencies.
+     * @throws SiVAL::Exceptions::OutOfRange If the index is invalid.
+     */
+    const double* row(std::size_t angle) const;
+
+    /**
+     * @brief Returns the directivity of all angles (row-major, one row per angle).
+     */
+    const std::vector<double>& values() const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    double m_radius;
+    double m_speedOfSound;
+    SiVAL::FrequencyGrid m_grid;
+    std::vector<double> m_angles;
+    std::vector<double> m_values;
+    //// end private member
+};
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/core/spectrum.hpp>
+#include <sival/libsival.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+namespace SiVAL::Response {
+class PolarResponse;
+}
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Response {
+/**
+ * @class PowerResponse
+ * @ingroup Response
+ * @brief Sound power response and directivity index from a polar response.
+ *
+ * @details The radiation of a piston is rotationally symmetric, so the integral
+ * over the sphere reduces to an integral over the polar angle:
+ *
+ * \f[ \overline{D^2}(f) = \frac{1}{4 \pi} \oint D^2 \, d\Omega
+ *     = \frac{1}{2} \int_0^{\pi} D^2(\theta, f) \sin\theta \, d\theta
+ *     \approx \frac{1}{2} \sum_j w_j D^2(\theta_j, f) \f]
+ *
+ * The quadrature weights \f$ w_j \f$ are calculated once from the angles of the
+ * `PolarResponse` in \f$ [0°, 180°] \f$. They integrate \f$ \sin\theta \f$ exactly
+ * for a piecewise linear \f$ D^2 \f$, so \f$ \sum_j w_j = 2 \f$ and an
+ * omnidirectional source has a directivity index of exactly 0 dB.
+ * The accuracy is limited by the angular resolution. The step of the baffled
+ * piston at 90° causes an error of about 0.2 dB with a 5° grid.
+ *
+ * From the mean square directivity follow
+ *
+ * \f[ DI = 10 \log_{10} \frac{D^2(0, f)}{\overline{D^2}(f)} \qquad
+ *     P_{ac} = \frac{4 \pi r^2 |p_0|^2}{\rho_0 c} \overline{D^2} \f]
+ *
+ * where \f$ p_0 \f$ is the on-axis pressure at the distance \f$ r \f$.
+ *
+ * The reduction over the angles is split into bands of frequencies that are
+ * processed in parallel (`SiVAL::Utils::parallelFor`). Within a band all rows
+ * are accumulated into a small block that stays in the cache.
+ */
+class LIB_SIVAL_EXPORT PowerResponse
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @brief Creates the quadrature for the angles of a polar response.
+     * @param polar An evaluated polar response. It must contain the angles 0° and 180°.
+     * @throws SiVAL::Exceptions::OutOfRange If the angles do not cover 0° to 180°.
+     */
+    explicit PowerResponse(const PolarResponse &polar);
+    /// Destructor
+    ~PowerResponse();
+
+    /**
+     * @brief Returns the spherical mean \f$ \overline{D^2} \f$ per frequency.
+     */
+    const std::vector<double>& average() const;
+
+    /**
+     * @brief Returns the directivity index in dB per frequency.
+     */
+    const std::vector<double>& directivityIndex() const;
+
+    /**
+     * @brief Integrates the polar response over the sphere.
+     * @param threads The number of threads, 0 selects all hardware threads.
+     */
+    void evaluate(std::size_t threads = 0);
+
+    /**
+     * @brief Returns the sound power response as spherically averaged SPL in dB.
+     * @details This is the on-axis SPL minus the directivity index.
+     * @param onAxis The on-axis pressure on the grid of the polar response.
+     * @throws SiVAL::Exceptions::OutOfRange If the size does not match.
+     */
+    std::vector<double> powerSpl(const SiVAL::Spectrum &onAxis) const;
+
+    /**
+     * @brief Returns the radiated acoustic power in Watt per frequency.
+     * @param onAxis The on-axis pressure (RMS) on the grid of the polar response.
+     * @param distance The distance of the on-axis pressure in meters.
+     * @param densityOfAir The density of air in kg/m³.
+     * @param speedOfSound The speed of sound in m/s.
+     * @throws SiVAL::Exceptions::OutOfRange If the size does not match.
+     */
+    std::vector<double> soundPower(const SiVAL::Spectrum &onAxis, double distance,
+                                   double densityOfAir = SiVAL::RHO0, double speedOfSound = SiVAL::C_SOUND) const;
+
+    /**
+     * @brief Returns the quadrature weight of every angle of the polar response.
+     * @details Angles outside of \f$ [0°, 180°] \f$ and repeated angles have the weight 0.
+     */
+    const std::vector<double>& weights() const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    const PolarResponse &m_polar;
+    std::vector<double> m_weights;
+    std::size_t m_axis;
+    std::vector<double> m_average;
+    std::vector<double> m_directivityIndex;
+    //// end private member
+};
+}
@@ -0,0 +1,202 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <string>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/core/frequencygrid.hpp>
+#include <sival/core/resampler.hpp>
+#include <sival/core/spectrum.hpp>
+#include <sival/libsival.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Response {
+/**
+ * @class Measurement
+ * @ingroup Response
+ * @brief A measured frequency response (.frd) or impedance (.zma).
+ *
+ * @details Both formats are plain text with one data point per line:
+ *
+ * | Column | .frd (`ResponseType::Spl`) | .zma (`ResponseType::Impedance`) |
+ * | :----- | :------------------------- | :------------------------------- |
+ * | 1      | Frequency in Hz            | Frequency in Hz                  |
+ * | 2      | SPL in dB re 20 µPa        | Magnitude in Ohm                 |
+ * | 3      | Phase in degrees (optional)| Phase in degrees (optional)      |
+ *
+ * The columns may be separated by blanks, tabs, commas or semicolons. Lines that
+ * do not start with a number (headers, comments with `*`, `#`, `;` or `"`) and
+ * lines with fewer than two numbers are skipped, as are points whose frequency
+ * is not above the previous one.
+ *
+ * **Parsing**
+ *
+ * `load()` maps the file into memory (`Utils::MappedFile`) and `parse()` scans
+ * the bytes once with `std::from_chars()`, without creating a string per line.
+ * Many files are loaded in parallel by the overload that takes a list of paths.
+ *
+ * **Usage**
+ *
+ * `resample()` converts the measurement into a complex `Spectrum` on any
+ * `FrequencyGrid` (see `SiVAL::Resampler`): the sound pressure in Pa at the measurement distance (so
+ * `Spectrum::magnitudeDb(SiVAL::P_REF)` returns the SPL again) or the impedance
+ * in Ohm. The result can be used like the output of `DriverModel` or `Summation`.
+ */
+class LIB_SIVAL_EXPORT Measurement
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @brief Creates an empty measurement.
+     */
+    Measurement();
+
+    /**
+     * @brief Creates a measurement from data points.
+     * @param type `ResponseType::Spl` or `ResponseType::Impedance`.
+     * @param frequencies The strictly increasing frequencies in Hz.
+     * @param magnitude The SPL in dB or the impedance in Ohm.
+     * @param phase The phase in degrees.
+     * @throws SiVAL::Exceptions::OutOfRange If the sizes differ or the frequencies are invalid.
+     */
+    Measurement(SiVAL::ResponseType type, std::vector<double> frequencies, std::vector<double> magnitude,
+                std::vector<double> phase);
+    /// Destructor
+    ~Measurement();
+
+    /**
+     * @brief Returns the frequencies of the data points as grid.
+     */
+    const SiVAL::FrequencyGrid& grid() const;
+
+    /**
+     * @brief Loads a file, the type is selected by the extension (.frd or .zma).
+     * @throws SiVAL::Exceptions::FileAccessError If the file cannot be read.
+     * @throws SiVAL::Exceptions::OutOfRange If the extension is unknown or the file has fewer than two data points.
+     */
+    static Measurement load(const std::string &path);
+
+    /**
+     * @brief Loads a file of a given type.
+     * @throws SiVAL::Exceptions::FileAccessError If the file cannot be read.
+     * @throws SiVAL::Exceptions::OutOfRange If the file has fewer than two data points.
+     */
+    static Measurement load(const std::string &path, SiVAL::ResponseType type);
+
+    /**
+     * @brief Loads several files in parallel, the types are selected by the extensions.
+     * @param paths The paths of the files.
+     * @param threads The number of threads, 0 selects all hardware threads.
+     * @return One measurement per path, in the same order.
+     * @throws SiVAL::Exception The first error of any file.
+     */
+    static std::vector<Measurement> load(const std::vector<std::string> &paths, std::size_t threads = 0);
+
+    /**
+     * @brief Returns the SPL in dB or the impedance in Ohm of the data points.
+     */
+    const std::vector<double>& magnitude() const;
+
+    /**
+     * @brief Parses the text of a measurement file.
+     * @param begin The first character.
+     * @param end The position behind the last character.
+     * @param type `ResponseType::Spl` or `ResponseType::Impedance`.
+     * @throws SiVAL::Exceptions::OutOfRange If the text has fewer than two data points.
+     */
+    static Measurement parse(const char* begin, const char* end, SiVAL::ResponseType type);
+
+    /**
+     * @brief Returns the phase of the data points in degrees, as found in the file.
+     */
+    const std::vector<double>& phase() const;
+
+    /**
+     * @brief Interpolates the measurement onto a frequency grid.
+     * @details The level in dB (or the impedance in Ohm) and the unwrapped phase are
+     * interpolated over \f$ \log f \f$. Outside of the measured range the first or
+     * last point is held.
+     * @param grid The target grid.
+     * @param out Receives the pressure in Pa or the impedance in Ohm. It is resized if necessary.
+     * @param method The interpolation method.
+     * @throws SiVAL::Exceptions::OutOfRange If the measurement is empty.
+     */
+    void resample(const SiVAL::FrequencyGrid &grid, SiVAL::Spectrum &out,
+                  SiVAL::Resampler::Method method = SiVAL::Resampler::Method::Linear) const;
+
+    /**
+     * @brief Interpolates the measurement with a prepared resampler.
+     * @details Measurements of the same rig usually share one grid, so one resampler
+     * can be reused for all of them.
+     * @throws SiVAL::Exceptions::OutOfRange If the source grid of the resampler differs from `grid()`.
+     */
+    void resample(const SiVAL::Resampler &resampler, SiVAL::Spectrum &out) const;
+
+    /**
+     * @brief Returns the number of data points.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Returns `ResponseType::Spl` or `ResponseType::Impedance`.
+     */
+    SiVAL::ResponseType type() const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    SiVAL::ResponseType m_type;
+    SiVAL::FrequencyGrid m_grid;
+    std::vector<double> m_magnitude;
+    std::vector<double> m_phase;
+    //// end private member
+};
+}
@@ -0,0 +1,210 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+#include <nlohmann/json.hpp>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/core/voicecoil.hpp>
+#include <sival/response/measurement/measurement.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+namespace SiVAL {
+class AbstractDriver;
+}
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Response {
+/**
+ * @class ThieleSmallFit
+ * @ingroup Response
+ * @brief Extracts the Thiele-Small parameters from a measured impedance.
+ *
+ * @details The model is the voice coil (see `SiVAL::VoiceCoil`) in series with the motional impedance:
+ *
+ * \f[ Z(\omega) = R_e + Z_{vc}(\omega) + \frac{R_e Q_{ms} / Q_{es}}{1 + j Q_{ms} \left( \frac{\omega}{\omega_s} - \frac{\omega_s}{\omega} \right)} \f]
+ *
+ * The parameters \f$ R_e, f_s, Q_{ms}, Q_{es} \f$ and those of the voice coil model are found by a
+ * Levenberg-Marquardt search in logarithmic coordinates (they stay positive and
+ * have comparable scales). The residuals are the deviations of the real and
+ * imaginary part (or only of the magnitude, if `usePhase` is false) relative
+ * to the measured magnitude. The Jacobian is analytic:
+ *
+ * \f[ R_e \frac{\partial Z}{\partial R_e} = R_e + Z_m \quad
+ *     Q_{es} \frac{\partial Z}{\partial Q_{es}} = -Z_m \quad
+ *     Q_{ms} \frac{\partial Z}{\partial Q_{ms}} = \frac{Z_m}{D} \quad
+ *     f_s \frac{\partial Z}{\partial f_s} = Z_m \frac{j Q_{ms}}{D} \left( \frac{\omega}{\omega_s} + \frac{\omega_s}{\omega} \right) \f]
+ *
+ * plus the derivatives of \f$ Z_{vc} \f$ (`SiVAL::VoiceCoil::derivatives()`),
+ * with \f$ Z_m \f$ the motional impedance and \f$ D \f$ its denominator. The
+ * normal equations \f$ J^T J \f$ and \f$ J^T r \f$ are accumulated point by point,
+ * so the Jacobian is never stored. The start values are taken from the curve
+ * (minimum, resonance peak, \f$ \sqrt{r_0} \f$ bandwidth and the slope at the
+ * highest frequency). Models other than `Simple` start from a fit with a single
+ * inductance, their parameters are initialised from its \f$ L_e \f$.
+ *
+ * **Mechanical parameters**
+ *
+ * An impedance curve alone does not contain the moving mass. With a second fit
+ * of the same driver, either with an added mass (`addedMass()`) or in a closed
+ * box of known volume (`knownVolume()`), \f$ M_{ms} \f$, \f$ C_{ms} \f$,
+ * \f$ V_{as} \f$, \f$ Bl \f$ and \f$ R_{ms} \f$ are completed.
+ *
+ * **Throughput**
+ *
+ * The measured points of the band are copied once into a work buffer; the
+ * iterations themselves do not allocate. Batches of measurements are fitted in
+ * parallel with one work buffer per thread.
+ */
+class LIB_SIVAL_EXPORT ThieleSmallFit
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @struct Settings
+     * @brief Controls the fit.
+     */
+    struct Settings {
+        double minFrequency = 0.0;      ///< Lower end of the fitted band in Hz.
+        double maxFrequency = 20000.0;  ///< Upper end of the fitted band in Hz.
+        bool usePhase = true;           ///< Fit the complex impedance, otherwise only its magnitude.
+        SiVAL::VoiceCoil::Model voiceCoil = SiVAL::VoiceCoil::Model::Simple; ///< The fitted voice coil model.
+        std::size_t iterations = 100;   ///< Maximum number of Levenberg-Marquardt steps.
+        double tolerance = 1e-10;       ///< Stop when the relative improvement of the cost is smaller.
+        std::size_t threads = 0;        ///< Number of threads for batches, 0 selects all hardware threads.
+    };
+
+    /**
+     * @struct Result
+     * @brief The fitted parameters in SI units.
+     */
+    struct Result {
+        double re = 0.0;                ///< DC resistance in Ohm.
+        double le = 0.0;                ///< Voice coil inductance in H (equivalent value at 1 kHz for `Wright` and `Leach`).
+        double fs = 0.0;                ///< Resonance frequency in Hz.
+        double qms = 0.0;               ///< Mechanical quality factor.
+        double qes = 0.0;               ///< Electrical quality factor.
+        double qts = 0.0;               ///< Total quality factor.
+        SiVAL::VoiceCoil voiceCoil;     ///< The fitted voice coil model.
+        std::optional<double> mms;      ///< Moving mass in kg (see `addedMass()`, `knownVolume()`).
+        std::optional<double> cms;      ///< Compliance in m/N.
+        std::optional<double> vas;      ///< Equivalent volume in m³.
+        std::optional<double> bl;       ///< Force factor in Tm.
+        std::optional<double> rms;      ///< Mechanical resistance in Ns/m.
+        double error = 0.0;             ///< RMS of the relative residuals.
+        std::size_t iterations = 0;     ///< Number of performed steps.
+        bool converged = false;         ///< True if the tolerance was reached.
+    };
+
+    /// Constructor
+    ThieleSmallFit();
+    /// Destructor
+    ~ThieleSmallFit();
+
+    /**
+     * @brief Completes the mechanical parameters by the added mass method.
+     * @details \f$ M_{ms} = M / \left( (f_s / f_s')^2 - 1 \right) \f$
+     * @param free The fit of the unloaded driver, completed in place.
+     * @param loaded The fit of the same driver with the added mass.
+     * @param mass The added mass in kg.
+     * @param sd The effective piston area in m².
+     * @throws SiVAL::Exceptions::OutOfRange If the resonance did not drop or a value is not positive.
+     */
+    static void addedMass(Result &free, const Result &loaded, double mass, double sd);
+
+    /**
+     * @brief Fits one impedance measurement with the default settings.
+     * @throws SiVAL::Exceptions::OutOfRange If it is no impedance or has fewer than five points in the band.
+     */
+    Result fit(const Measurement &impedance) const;
+
+    /**
+     * @brief Fits one impedance measurement.
+     * @throws SiVAL::Exceptions::OutOfRange If it is no impedance or has fewer than five points in the band.
+     */
+    Result fit(const Measurement &impedance, const Settings &settings) const;
+
+    /**
+     * @brief Fits several impedance measurements in parallel.
+     * @return One result per measurement, in the same order.
+     * @throws SiVAL::Exceptions::OutOfRange The first error of any measurement.
+     */
+    std::vector<Result> fit(const std::vector<Measurement> &impedances, const Settings &settings) const;
+
+    /**
+     * @brief Completes the mechanical parameters by the known volume method.
+     * @details \f$ V_{as} = V_b \left( \frac{f_c Q_{ec}}{f_s Q_{es}} - 1 \right) \f$
+     * @param free The fit of the driver in free air, completed in place.
+     * @param boxed The fit of the same driver in a closed box.
+     * @param volume The net volume of the box in m³.
+     * @param sd The effective piston area in m².
+     * @throws SiVAL::Exceptions::OutOfRange If the resonance did not rise or a value is not positive.
+     */
+    static void knownVolume(Result &free, const Result &boxed, double volume, double sd);
+
+    /**
+     * @brief Creates a driver with the fitted parameters.
+     * @details The reference data (e.g. the datasheet of the production model) supplies
+     * everything an impedance fit cannot deliver. `re`, `le`, `fs`, `qms`, `qes`, `voice_coil` and,
+     * if known, the mechanical parameters are replaced; `qts`, `cms`, `stiffness`,
+     * `vas` and `sensitivity` are derived again by the driver.
+     * @param result The fit.
+     * @param reference Driver JSON data according to the schema of `AbstractDriver`.
+     */
+    static std::shared_ptr<SiVAL::AbstractDriver> toDriver(const Result &result, const nlohmann::json &reference);
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    struct Workspace;
+    Result fit(Workspace &workspace, const Measurement &impedance, const Settings &settings) const;
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    //// end private member
+};
+}
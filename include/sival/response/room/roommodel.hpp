@@ -0,0 +1,217 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/core/frequencygrid.hpp>
+#include <sival/core/spectrum.hpp>
+#include <sival/libsival.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Response {
+/**
+ * @class RoomModel
+ * @ingroup Response
+ * @brief Low-frequency response of a rectangular room by modal summation.
+ *
+ * @details The sound field of a point source with the volume velocity \f$ Q \f$ in a
+ * rectangular room \f$ L_x \times L_y \times L_z \f$ with rigid walls is the sum of
+ * its eigenmodes
+ *
+ * \f[ p(\omega) = j \omega \rho_0 Q \frac{c^2}{V} \sum_n
+ *     \frac{\psi_n(\vec{s}) \psi_n(\vec{l})}{\Lambda_n \left( \omega_n^2 - \omega^2 + 2 j \delta \omega \right)}
+ *     \qquad \psi_n(\vec{r}) = \cos\frac{n_x \pi x}{L_x} \cos\frac{n_y \pi y}{L_y} \cos\frac{n_z \pi z}{L_z} \f]
+ *
+ * with the source \f$ \vec{s} \f$, the listener \f$ \vec{l} \f$, the norm
+ * \f$ \Lambda_n = \varepsilon_x \varepsilon_y \varepsilon_z \f$ (\f$ \varepsilon = 1 \f$
+ * for \f$ n = 0 \f$, otherwise \f$ 1/2 \f$) and the damping constant
+ * \f$ \delta = 3 \ln 10 / T_{60} \f$. All modes up to `maxFrequency` are used,
+ * so the model is valid well below that frequency.
+ *
+ * The result is a transfer function relative to the half space pressure of the
+ * same source at 1 m, which is what `DriverModel::pressure()` and the SPL
+ * responses of the enclosures deliver:
+ *
+ * \f[ p_{room} = H \cdot p_{1m} \qquad H = 2 \pi \cdot 1\,\mathrm{m} \cdot \frac{c^2}{V}
+ *     \sum_n \frac{\psi_n(\vec{s}) \psi_n(\vec{l})}{\Lambda_n \left( \omega_n^2 - \omega^2 + 2 j \delta \omega \right)} \f]
+ *
+ * An SPL curve in dB is therefore combined by adding `gainDb()`.
+ *
+ * **Caching**
+ *
+ * The mode table (wave numbers, \f$ \omega_n^2 \f$, \f$ 1 / \Lambda_n \f$) is
+ * created once in the constructor. `prepare()` additionally stores the modal
+ * denominators for a frequency grid, which do not depend on any position. A
+ * transfer function then only needs the \f$ M \f$ mode shape products of the
+ * position pair and one multiply-add per mode and frequency. Several listener
+ * positions are evaluated in parallel.
+ */
+class LIB_SIVAL_EXPORT RoomModel
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @struct Position
+     * @brief A position in the room in meters, measured from one corner.
+     */
+    struct Position {
+        double x = 0.0; ///< Along the length in meters.
+        double y = 0.0; ///< Along the width in meters.
+        double z = 0.0; ///< Along the height in meters.
+    };
+
+    /**
+     * @brief Creates the mode table of a rectangular room.
+     * @param length The length \f$ L_x \f$ in meters.
+     * @param width The width \f$ L_y \f$ in meters.
+     * @param height The height \f$ L_z \f$ in meters.
+     * @param reverberationTime The reverberation time \f$ T_{60} \f$ in seconds.
+     * @param maxFrequency The frequency of the highest mode in Hz.
+     * @param speedOfSound The speed of sound in m/s.
+     * @throws SiVAL::Exceptions::OutOfRange If a dimension, the reverberation time or the frequency is not positive.
+     */
+    RoomModel(double length, double width, double height, double reverberationTime = 0.4,
+              double maxFrequency = 300.0, double speedOfSound = SiVAL::C_SOUND);
+    /// Destructor
+    ~RoomModel();
+
+    /**
+     * @brief Calculates the room pressure for a pressure at a given distance.
+     * @param pressure The half space pressure of the source at `distance`.
+     * @param distance The distance of `pressure` in meters.
+     * @param source The position of the source.
+     * @param listener The position of the listener.
+     * @param out Receives the pressure at the listener. It is resized if necessary.
+     * @throws SiVAL::Exceptions::OutOfRange If the size does not match the prepared grid.
+     */
+    void apply(const SiVAL::Spectrum &pressure, double distance, const Position &source,
+               const Position &listener, SiVAL::Spectrum &out) const;
+
+    /**
+     * @brief Returns the room gain \f$ 20 \log_{10} |H| \f$ in dB relative to 1 m in half space.
+     */
+    std::vector<double> gainDb(const Position &source, const Position &listener) const;
+
+    /**
+     * @brief Returns the prepared frequency grid.
+     */
+    const SiVAL::FrequencyGrid& grid() const;
+
+    /**
+     * @brief Returns the height of the room in meters.
+     */
+    double height() const;
+
+    /**
+     * @brief Returns the length of the room in meters.
+     */
+    double length() const;
+
+    /**
+     * @brief Returns the number of modes in the table.
+     */
+    std::size_t modeCount() const;
+
+    /**
+     * @brief Returns the eigenfrequency of a mode in Hz.
+     */
+    double modeFrequency(std::size_t mode) const;
+
+    /**
+     * @brief Stores the modal denominators for a frequency grid.
+     */
+    void prepare(const SiVAL::FrequencyGrid &grid);
+
+    /**
+     * @brief Calculates the transfer function \f$ H \f$ from a source to a listener.
+     * @param out Receives one value per grid point. It is resized if necessary.
+     * @throws SiVAL::Exceptions::OutOfRange If no grid is prepared or a position is outside of the room.
+     */
+    void transfer(const Position &source, const Position &listener, SiVAL::Spectrum &out) const;
+
+    /**
+     * @brief Calculates the transfer functions from one source to several listeners in parallel.
+     * @param out Receives one spectrum per listener.
+     * @param threads The number of threads, 0 selects all hardware threads.
+     * @throws SiVAL::Exceptions::OutOfRange If no grid is prepared or a position is outside of the room.
+     */
+    void transfer(const Position &source, const std::vector<Position> &listeners,
+                  std::vector<SiVAL::Spectrum> &out, std::size_t threads = 0) const;
+
+    /**
+     * @brief Returns the width of the room in meters.
+     */
+    double width() const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    void check(const Position &position) const;
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    double m_length;
+    double m_width;
+    double m_height;
+    double m_damping;
+    double m_speedOfSound;
+
+    // Mode table (SoA): wave numbers n pi / L, squared eigenfrequency and 1 / Lambda
+    std::vector<double> m_kx;
+    std::vector<double> m_ky;
+    std::vector<double> m_kz;
+    std::vector<double> m_omega2;
+    std::vector<double> m_inverseNorm;
+
+    // Scaled denominators 2 pi c^2 / (V (w_n^2 - w^2 + 2 j delta w)), one row per mode
+    SiVAL::FrequencyGrid m_grid;
+    std::vector<double> m_denominatorReal;
+    std::vector<double> m_denominatorImag;
+    //// end private member
+};
+}
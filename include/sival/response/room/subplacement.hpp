@@ -0,0 +1,193 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/core/spectrum.hpp>
+#include <sival/libsival.hpp>
+#include <sival/response/room/roommodel.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Response {
+/**
+ * @class SubwooferPlacement
+ * @ingroup Response
+ * @brief Searches positions, delays and gains of several subwoofers for an even response over the seats.
+ *
+ * @details Out of a set of candidate positions `subs` positions are chosen. The pressure
+ * at seat \f$ s \f$ is
+ *
+ * \f[ p_s(\omega) = \sum_k g_k \, e^{-j \omega \tau_k} \, H(\vec{c}_k, \vec{l}_s, \omega) \, p_{1m}(\omega) \f]
+ *
+ * with the room transfer function \f$ H \f$ of a `RoomModel`, the half space
+ * pressure \f$ p_{1m} \f$ of one subwoofer at 1 m (e.g. the role response of a
+ * `Summation` divided by the driver count) and the gain \f$ g_k \f$ and delay
+ * \f$ \tau_k \f$ of each subwoofer. The cost is the seat-to-seat variance of the
+ * level, averaged over the frequencies of the optimization band:
+ *
+ * \f[ J = \frac{1}{N} \sum_i \frac{1}{S} \sum_s \left( L_{s,i} - \bar{L}_i \right)^2 \qquad L_{s,i} = 20 \log_{10} |p_s(\omega_i)| \f]
+ *
+ * **Search**
+ *
+ * The products \f$ H \cdot p_{1m} \f$ of every candidate and seat are calculated
+ * once in `prepare()` (in parallel over the candidates) and reused for every
+ * placement. All combinations of `subs` candidates are then evaluated in parallel.
+ * For each combination the gains of all but the first subwoofer (the reference)
+ * and the delays of all subwoofers are tuned by a pattern search with shrinking
+ * steps, so the reference can also play later than the others. Afterwards the
+ * delays are shifted so that the earliest subwoofer has a delay of 0, which does
+ * not change the levels. The work buffers are allocated once per thread.
+ */
+class LIB_SIVAL_EXPORT SubwooferPlacement
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @struct Settings
+     * @brief Controls the search.
+     */
+    struct Settings {
+        std::size_t subs = 2;           ///< Number of subwoofers to place.
+        double minFrequency = 20.0;     ///< Lower end of the optimization band in Hz.
+        double maxFrequency = 120.0;    ///< Upper end of the optimization band in Hz.
+        bool optimizeGain = true;       ///< Tune the gain of each subwoofer.
+        double minGain = -12.0;         ///< Lowest gain in dB.
+        double maxGain = 0.0;           ///< Highest gain in dB.
+        bool optimizeDelay = true;      ///< Tune the delay of each subwoofer.
+        double maxDelay = 0.02;         ///< Highest delay in seconds (the lowest is 0).
+        std::size_t iterations = 200;   ///< Maximum number of pattern search steps per combination.
+        std::size_t threads = 0;        ///< Number of threads, 0 selects all hardware threads.
+    };
+
+    /**
+     * @struct Result
+     * @brief The best placement found.
+     */
+    struct Result {
+        std::vector<std::size_t> candidates;          ///< The indices of the chosen candidates.
+        std::vector<RoomModel::Position> positions;   ///< The chosen positions.
+        std::vector<double> gains;                    ///< The gain of each subwoofer in dB.
+        std::vector<double> delays;                   ///< The delay of each subwoofer in seconds.
+        double cost = 0.0;                            ///< The mean seat-to-seat variance in dB².
+        std::size_t combinations = 0;                 ///< The number of evaluated combinations.
+    };
+
+    /**
+     * @brief Creates the search for a prepared room model.
+     * @param room A room model with a prepared frequency grid.
+     * @param pressure The half space pressure of one subwoofer on the grid of the room.
+     * @param distance The distance of `pressure` in meters.
+     * @throws SiVAL::Exceptions::OutOfRange If the size does not match the grid of the room.
+     */
+    SubwooferPlacement(const RoomModel &room, const SiVAL::Spectrum &pressure, double distance = 1.0);
+    /// Destructor
+    ~SubwooferPlacement();
+
+    /**
+     * @brief Adds a possible subwoofer position.
+     */
+    void addCandidate(const RoomModel::Position &position);
+
+    /**
+     * @brief Adds a seat of the listening area.
+     */
+    void addSeat(const RoomModel::Position &position);
+
+    /**
+     * @brief Returns the candidate positions.
+     */
+    const std::vector<RoomModel::Position>& candidates() const;
+
+    /**
+     * @brief Calculates the cost of a given placement.
+     * @param candidates The indices of the chosen candidates.
+     * @param gains The gain of each subwoofer in dB.
+     * @param delays The delay of each subwoofer in seconds.
+     * @param settings The optimization band.
+     * @throws SiVAL::Exceptions::OutOfRange If the sizes differ or an index is invalid.
+     */
+    double cost(const std::vector<std::size_t> &candidates, const std::vector<double> &gains,
+                const std::vector<double> &delays, const Settings &settings);
+
+    /**
+     * @brief Searches the best placement.
+     * @throws SiVAL::Exceptions::OutOfRange If there are fewer candidates than subwoofers,
+     * fewer than two seats or no frequency in the band.
+     */
+    Result optimize(const Settings &settings);
+
+    /**
+     * @brief Returns the seats.
+     */
+    const std::vector<RoomModel::Position>& seats() const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    struct Workspace;
+    void prepare(const Settings &settings);
+    double evaluate(Workspace &workspace, const std::size_t* candidates, const double* gains,
+                    const double* delays) const;
+    double search(Workspace &workspace, const std::size_t* candidates, const Settings &settings) const;
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    const RoomModel &m_room;
+    SiVAL::Spectrum m_pressure;
+    std::vector<RoomModel::Position> m_candidates;
+    std::vector<RoomModel::Position> m_seats;
+
+    // Cached H * p_1m, [candidate][seat][band frequency], valid for m_begin/m_end
+    bool m_prepared;
+    std::size_t m_begin;
+    std::size_t m_end;
+    std::vector<double> m_transferReal;
+    std::vector<double> m_transferImag;
+    //// end private member
+};
+}
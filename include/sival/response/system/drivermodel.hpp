@@ -0,0 +1,212 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/abstractions/enclosure.hpp>
+#include <sival/core/drivesource.hpp>
+#include <sival/core/frequencygrid.hpp>
+#include <sival/core/roleconfig.hpp>
+#include <sival/core/spectrum.hpp>
+#include <sival/core/voicecoil.hpp>
+#include <sival/libsival.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Response {
+/**
+ * @class DriverModel
+ * @ingroup Response
+ * @brief Lumped-element model of one role (driver, quantity and enclosure) evaluated over a `FrequencyGrid`.
+ *
+ * @details The model is the shared system solve of the library. Upon construction all
+ * frequency-independent terms are derived once from the `RoleConfig` and the
+ * `AbstractEnclosure` and stored in a coefficient cache (`Coefficients`). The
+ * evaluation functions then only perform a few multiply-adds per frequency on
+ * contiguous arrays.
+ *
+ * Several identical drivers of a role are described by one equivalent driver.
+ * The `n` drivers are wired as \f$ p \f$ parallel strings of \f$ s \f$ drivers
+ * in series (`Wiring::Parallel`: \f$ s = 1 \f$, `Wiring::Series`: \f$ s = n \f$,
+ * `Wiring::SeriesParallel`: \f$ s \f$ = `RoleConfig::series`). The equivalent
+ * driver has
+ *
+ * \f[ R_e' = \frac{s}{p} R_e \quad L_e' = \frac{s}{p} L_e \quad Bl' = s \, Bl \quad
+ *     M_{ms}' = n M_{ms} \quad R_{ms}' = n R_{ms} \quad K_{ms}' = n K_{ms} \quad S_d' = a \, n S_d \f]
+ *
+ * with \f$ a = 1/2 \f$ for `Wiring::Isobaric`, where only one cone of each pair
+ * radiates, and \f$ a = 1 \f$ otherwise. Push-pull pairs behave like parallel
+ * drivers in this linear model. The derived values follow directly, e.g. an
+ * isobaric pair has half the \f$ V_{as} \f$ of a single driver, and a series
+ * pair has the sensitivity of a single driver at the same voltage.
+ *
+ * **Electrical and mechanical impedances**
+ *
+ * \f[ Z_e = R_e + Z_{vc}(\omega) \qquad Z_m = R_{ms} + j \left( \omega M_{ms} - \frac{K_{ms} + K_{mb}}{\omega} \right) \f]
+ *
+ * with the stiffness of the enclosed air \f$ K_{mb} = \rho_0 c^2 S_d^2 / V_b \f$ and
+ * the voice coil impedance \f$ Z_{vc} \f$ of `AbstractDriver::voiceCoil()`
+ * (\f$ j \omega L_e \f$ for the simple model). `prepare()` stores \f$ Z_{vc} \f$ for
+ * a frequency grid, so the powers of the extended models are calculated once and
+ * `impedance()` and `pressure()` stay a single pass over the grid. Other grids
+ * evaluate \f$ Z_{vc} \f$ on the fly.
+ *
+ * Only sealed enclosures (`EnclosureType::Sealed`, a volume of 0 being the
+ * infinite baffle) are modelled. A vented enclosure would need the port as a
+ * second radiator, which the enclosures do not describe yet, so it is rejected
+ * instead of being solved as a sealed box.
+ *
+ * **Cone velocity and on-axis sound pressure (half space)**
+ *
+ * \f[ u = \frac{Bl \cdot U_g}{Z_e Z_m + (Bl)^2} \qquad p = \frac{j \omega \rho_0 S_d u}{2 \pi r} \f]
+ *
+ * **Drive source**
+ *
+ * The series resistance \f$ R_g \f$ of amplifier and cable (`SiVAL::DriveSource`)
+ * is part of the shared solve: without a crossover the pressure uses
+ * \f$ R_e + R_g \f$ in \f$ Z_e \f$, which is folded into the coefficients before
+ * the loop. The impedance is still the one of the drivers alone, since it is the
+ * load of the source or of a crossover. A `Crossover::Solver` takes \f$ R_g \f$
+ * into its own solve, so the pressure of a filtered role is calculated without it
+ * (`pressure()` with `source = false`).
+ */
+class LIB_SIVAL_EXPORT DriverModel
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @struct Coefficients
+     * @brief The frequency-independent terms of the equivalent driver in SI units.
+     */
+    struct Coefficients {
+        double re = 0.0;   ///< Electrical series resistance in Ohm.
+        double le = 0.0;   ///< Voice coil inductance in Henry.
+        SiVAL::VoiceCoil voiceCoil; ///< Voice coil model of the equivalent driver.
+        double bl = 0.0;   ///< Force factor in Tm.
+        double mms = 0.0;  ///< Moving mass in kg.
+        double rms = 0.0;  ///< Mechanical resistance in Ns/m.
+        double kms = 0.0;  ///< Suspension stiffness in N/m.
+        double kmb = 0.0;  ///< Stiffness of the enclosed air in N/m (0 for an infinite baffle).
+        double sd = 0.0;   ///< Effective radiating area in m².
+        double vas = 0.0;  ///< Equivalent compliance volume \f$ \rho_0 c^2 S_d^2 / K_{ms} \f$ in m³.
+        double sensitivity = 0.0; ///< Passband SPL at 2.83 V and 1 m in half space in dB.
+        double rg = 0.0;   ///< Series resistance of amplifier and cable in Ohm.
+        double qts = 0.0;  ///< Effective total Q including \f$ R_g \f$.
+    };
+
+    /**
+     * @brief Builds the coefficient cache for a role.
+     * @param config The driver, its quantity and wiring.
+     * @param enclosure The enclosure the driver is mounted in. A volume of 0 is treated as infinite baffle.
+     * @param densityOfAir The density of air in kg/m³.
+     * @param speedOfSound The speed of sound in m/s.
+     * @param source The amplifier and cable that drive the role.
+     * @throws SiVAL::Exceptions::OutOfRange If the configuration contains no driver, the count does not fit the wiring
+     * or the enclosure is not sealed.
+     */
+    DriverModel(const RoleConfig &config, AbstractEnclosure &enclosure,
+                double densityOfAir = SiVAL::RHO0, double speedOfSound = SiVAL::C_SOUND,
+                const DriveSource &source = DriveSource());
+
+    /**
+     * @brief Returns the coefficient cache.
+     */
+    const Coefficients& coefficients() const;
+
+    /**
+     * @brief Calculates the complex electrical input impedance in Ohm.
+     * @param grid The frequencies to evaluate.
+     * @param out Receives one value per grid point. It is resized if necessary.
+     */
+    void impedance(const FrequencyGrid &grid, Spectrum &out) const;
+
+    /**
+     * @brief Stores the voice coil impedance for a frequency grid.
+     * @details Later calls of `impedance()` and `pressure()` with an equal grid use the stored values.
+     */
+    void prepare(const FrequencyGrid &grid);
+
+    /**
+     * @brief Calculates the complex on-axis sound pressure in Pascal.
+     * @details Evaluates the pressure and applies an optional delay
+     * \f$ e^{-j \omega \tau} \f$. A negative voltage inverts the polarity.
+     * @param grid The frequencies to evaluate.
+     * @param voltage The open circuit voltage of the source in Volt (e.g. 2.83 V).
+     * @param distance The listening distance in meters.
+     * @param out Receives one value per grid point. It is resized if necessary.
+     * @param delay The delay \f$ \tau \f$ in seconds.
+     * @param source False to leave out the series resistance of the drive source, e.g. for a role
+     * behind a `Crossover::Solver` that already contains it.
+     */
+    void pressure(const FrequencyGrid &grid, double voltage, double distance, Spectrum &out, double delay = 0.0,
+                  bool source = true) const;
+
+    /**
+     * @brief Returns the open circuit voltage of the drive source in Volt.
+     * @details For `DriveSource::Mode::ConstantPower` the voltage is derived from the power
+     * and the DC resistance of the equivalent driver, raised by the drop across the series resistance.
+     */
+    double sourceVoltage() const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    void voiceCoil(const FrequencyGrid &grid, std::vector<double> &real, std::vector<double> &imag,
+                   const double* &coilReal, const double* &coilImag) const;
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    Coefficients m_coefficients;
+    double m_densityOfAir;
+    double m_sourceVoltage;
+
+    // Z_vc on the prepared grid
+    FrequencyGrid m_grid;
+    std::vector<double> m_coilReal;
+    std::vector<double> m_coilImag;
+    //// end private member
+};
+}
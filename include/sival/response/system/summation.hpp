@@ -0,0 +1,236 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <map>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include <sival/abstractions/response.hpp>
+#include <sival/core/drivesource.hpp>
+#include <sival/core/frequencygrid.hpp>
+#include <sival/core/spectrum.hpp>
+#include <sival/response/system/drivermodel.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+namespace SiVAL {
+class AcousticSetup;
+}
+namespace SiVAL::Crossover {
+class Solver;
+}
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Response {
+/**
+ * @class Summation
+ * @ingroup Response
+ * @brief Calculates the on-axis sound pressure of a complete multi-way system.
+ *
+ * @details The class combines all roles (`DriverRole`) of an `AcousticSetup` into
+ * one curve. Every role is described by a `DriverModel` and contributes its
+ * complex sound pressure, so that the interference between the ways is taken
+ * into account. The alignment of each role is read from its `RoleConfig`:
+ *
+ * \f[ p_{sum}(\omega) = \sum_{k} \pm \, p_k(\omega) \cdot e^{-j \omega \left( \tau_k + \frac{d_k}{c} \right)} \f]
+ *
+ * where \f$ \tau_k \f$ is the signal delay (`delay`), \f$ d_k \f$ the acoustic offset
+ * (`offset`) and the sign is given by the polarity (`inverted`).
+ *
+ * The calculation is split into two steps. `prepare()` builds the coefficient
+ * caches and the aligned pressure of every role once on the shared grid.
+ * `evaluate()` then adds the cached role responses in a single pass over the
+ * grid. As long as the setup does not change, only `evaluate()` has to be
+ * called again.
+ */
+class LIB_SIVAL_EXPORT Summation : public AbstractResponse
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @brief Creates the summation for all roles of a setup.
+     * @param setup The setup whose drivers and enclosure are used. It must outlive this object.
+     */
+    explicit Summation(SiVAL::AcousticSetup &setup);
+    /// Destructor
+    virtual ~Summation();
+
+    /**
+     * @brief Returns the distance of the listening point in meters.
+     */
+    double distance() const;
+
+    /**
+     * @brief Adds the cached responses of all roles on the shared grid.
+     * @details Calls `prepare()` first if the role responses are not cached yet.
+     * @return The complex sum of the sound pressures in Pascal.
+     */
+    const SiVAL::Spectrum& evaluate();
+
+    /**
+     * @brief Adds the cached role responses, each filtered by its crossover.
+     * @details The pressure of every role is multiplied with the voltage transfer of its
+     * network in the same pass as the summation. The driver responses themselves are
+     * not recalculated, so this is cheap enough to be called after every change of a
+     * component value. Filtered roles use `terminalResponse()`, since the solver contains
+     * the source resistance. Roles without load in the solver are added unfiltered.
+     * @param crossover A solved crossover on the same grid.
+     * @return The complex sum of the sound pressures in Pascal.
+     * @throws SiVAL::Exceptions::OutOfRange If the grid or the source resistance of the crossover differs.
+     */
+    const SiVAL::Spectrum& evaluate(const SiVAL::Crossover::Solver &crossover);
+
+    /**
+     * @brief Returns the shared frequency grid.
+     */
+    const SiVAL::FrequencyGrid& grid() const;
+
+    /**
+     * @brief Returns the driver model of a role, e.g. to use it as load of a crossover.
+     * @throws SiVAL::Exceptions::OutOfRange If the role is not part of the summation.
+     */
+    const DriverModel& model(SiVAL::DriverRole role) const;
+
+    /**
+     * @brief Builds the driver models and caches the aligned pressure of every role.
+     * @details Must be called again after drivers, the enclosure or the alignment of a role changed.
+     * @throws SiVAL::Exceptions::OutOfRange If a role cannot be modelled (see `DriverModel`), e.g. in a vented enclosure.
+     */
+    void prepare();
+
+    /**
+     * @brief Calculates the summed SPL at one frequency.
+     * @param frequency The frequency in Hertz.
+     * @return The sound pressure level in dB SPL.
+     */
+    double response(double frequency) override;
+
+    /**
+     * @brief Returns the cached, aligned pressure of a single role.
+     * @throws SiVAL::Exceptions::OutOfRange If the role is not part of the summation.
+     */
+    const SiVAL::Spectrum& roleResponse(SiVAL::DriverRole role) const;
+
+    /**
+     * @brief Returns the cached, aligned pressure of a single role without the source resistance.
+     * @details This is the response behind a `Crossover::Solver`, which contains the source
+     * resistance itself. Without source resistance it equals `roleResponse()`.
+     * @throws SiVAL::Exceptions::OutOfRange If the role is not part of the summation.
+     */
+    const SiVAL::Spectrum& terminalResponse(SiVAL::DriverRole role) const;
+
+    /**
+     * @brief Returns the roles of the prepared summation.
+     */
+    std::vector<SiVAL::DriverRole> roles() const;
+
+    /**
+     * @brief Sets the distance of the listening point.
+     * @param distance The distance in meters (default 1 m).
+     */
+    void setDistance(double distance);
+
+    /**
+     * @brief Sets the shared frequency grid. Invalidates the cached role responses.
+     */
+    void setGrid(const SiVAL::FrequencyGrid &grid);
+
+    /**
+     * @brief Sets the amplifier and cable that drive all roles. Invalidates the cached role responses.
+     */
+    void setSource(const SiVAL::DriveSource &source);
+
+    /**
+     * @brief Sets a constant drive voltage that is applied to all roles.
+     * @details Switches the source to `DriveSource::Mode::ConstantVoltage` and keeps its resistance.
+     * @param voltage The voltage in Volt (default 2.83 V).
+     */
+    void setVoltage(double voltage);
+
+    /**
+     * @brief Returns the drive source.
+     */
+    const SiVAL::DriveSource& source() const;
+
+    /**
+     * @brief Returns the summed SPL of the last `evaluate()` in dB SPL.
+     */
+    std::vector<double> spl() const;
+
+    /**
+     * @brief Returns the result of the last `evaluate()`.
+     */
+    const SiVAL::Spectrum& sum() const;
+
+    /**
+     * @brief Returns the voltage of a constant voltage source in Volt.
+     */
+    double voltage() const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    /**
+     * @brief The cached state of one role.
+     */
+    struct Role {
+        DriverModel model;
+        double delay;
+        double sign;
+        SiVAL::Spectrum pressure;
+        SiVAL::Spectrum terminal; ///< Pressure without the source resistance (empty if there is none).
+    };
+
+    SiVAL::AcousticSetup &m_setup;
+    SiVAL::FrequencyGrid m_grid;
+    std::map<SiVAL::DriverRole, Role> m_roles;
+    SiVAL::Spectrum m_sum;
+    SiVAL::DriveSource m_source;
+    double m_distance;
+    bool m_prepared;
+    //// end private member
+};
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <string>
+//// end system includes
+
+//// begin project specific includes
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Utils {
+/**
+ * @class MappedFile
+ * @brief A read-only view of a whole file, mapped into memory.
+ *
+ * @details The file is mapped with `mmap()` (POSIX) or `MapViewOfFile()` (Windows),
+ * so parsers can work directly on the bytes of the file without copying them
+ * into strings or stream buffers. The mapping is released in the destructor.
+ * An empty file results in an empty view (`data()` is `nullptr`).
+ *
+ * The class is movable but not copyable.
+ */
+class LIB_SIVAL_EXPORT MappedFile
+{
+
+    //// begin public member methods
+public:
+    /**
+     * @brief Maps a file.
+     * @param path The path of the file.
+     * @throws SiVAL::Exceptions::FileAccessError If the file cannot be opened or mapped.
+     */
+    explicit MappedFile(const std::string &path);
+    MappedFile(MappedFile &&other) noexcept;
+    MappedFile& operator=(MappedFile &&other) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    /// Destructor
+    ~MappedFile();
+
+    /**
+     * @brief Returns the first byte of the file.
+     */
+    const char* begin() const;
+
+    /**
+     * @brief Returns the first byte of the file.
+     */
+    const char* data() const;
+
+    /**
+     * @brief Returns true if the file is empty.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Returns the position behind the last byte of the file.
+     */
+    const char* end() const;
+
+    /**
+     * @brief Returns the size of the file in bytes.
+     */
+    std::size_t size() const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    void release();
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    const char* m_data;
+    std::size_t m_size;
+    //// end private member
+};
+}
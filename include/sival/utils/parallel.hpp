@@ -0,0 +1,107 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Utils {
+/**
+ * @brief Returns the number of worker threads to use for a requested thread count.
+ * @param requested The requested number of threads, 0 selects the number of hardware threads.
+ * @param tasks The number of independent tasks. No more threads than tasks are used.
+ * @return A value between 1 and `tasks` (or 1 if there are no tasks).
+ */
+inline std::size_t threadCount(std::size_t requested, std::size_t tasks) {
+    std::size_t threads = requested;
+    if (threads == 0) {
+        threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+    return std::max<std::size_t>(1, std::min(threads, tasks));
+}
+
+/**
+ * @brief Executes `task(index, worker)` for every index in `[0, count)` on several threads.
+ *
+ * @details The indices are handed out dynamically through an atomic counter, so that
+ * tasks of different duration are balanced automatically. The second argument is the
+ * number of the executing worker in `[0, threadCount(threads, count))`. It allows a task
+ * to use per-thread work buffers without any locking.
+ *
+ * The first exception thrown by a task is rethrown in the calling thread after all
+ * workers have finished. Remaining indices are not processed anymore in that case.
+ *
+ * @param count The number of tasks.
+ * @param task The callable, invoked as `task(std::size_t index, std::size_t worker)`.
+ * @param threads The number of threads, 0 selects the number of hardware threads.
+ */
+template<typename Task>
+void parallelFor(std::size_t count, Task &&task, std::size_t threads = 0) {
+    const std::size_t workers = threadCount(threads, count);
+    if (workers <= 1) {
+        for (std::size_t i = 0; i < count; ++i) {
+            task(i, std::size_t(0));
+        }
+        return;
+    }
+
+    std::atomic<std::size_t> next(0);
+    std::exception_ptr error;
+    std::mutex errorMutex;
+
+    auto run = [&](std::size_t worker) {
+        for (std::size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+            try {
+                task(i, worker);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(errorMutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                next.store(count);
+            }
+        }
+    };
+
+    std::vector<std::thread> pool;
+    pool.reserve(workers - 1);
+    for (std::size_t w = 1; w < workers; ++w) {
+        pool.emplace_back(run, w);
+    }
+    run(0);
+    for (std::thread &thread : pool) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+}
@@ -9,11 +9,14 @@
  *
  */
 //// begin system includes
+#include <compare>
+#include <span>
 #include <string>
+#include <string_view>
 //// end system includes
 
 //// begin project specific includes
-
+#include <sival/core/exceptions.hpp>
 //// end project specific includes
 
 //// begin using namespaces
@@ -29,6 +32,141 @@
 //// end extern declaration
 
 namespace SiVAL::Utils {
+/**
+ * @brief The physical dimensions that datasheets give with a unit.
+ */
+enum class Dimension {
+    Length = 0,  ///< SI unit m.
+    Area,        ///< SI unit m².
+    Volume,      ///< SI unit m³.
+    Mass         ///< SI unit kg.
+};
+
+/**
+ * @struct Unit
+ * @brief A unit of a dimension, given by its factor to the SI unit.
+ *
+ * @details The units known to the library are the constants in `Units`. A unit
+ * string from a datasheet is looked up once with `SIConverter::parse()`; after that
+ * a conversion is one multiplication.
+ */
+struct Unit {
+    Dimension dimension;
+    double factor;     ///< Value in SI = value in this unit · factor.
+
+    /// Converts a value in this unit to the SI unit.
+    constexpr double toSI(double value) const {
+        return value * factor;
+    }
+    /// Converts a value in the SI unit to this unit.
+    constexpr double fromSI(double value) const {
+        return value / factor;
+    }
+    constexpr bool operator==(const Unit&) const = default;
+};
+
+/**
+ * @brief The units of `SIConverter`, usable at compile time (e.g. `Length::of<Units::mm>(5.0)`).
+ */
+namespace Units {
+inline constexpr Unit m{Dimension::Length, 1.0};
+inline constexpr Unit cm{Dimension::Length, 1e-2};
+inline constexpr Unit mm{Dimension::Length, 1e-3};
+inline constexpr Unit in{Dimension::Length, 0.0254};
+inline constexpr Unit ft{Dimension::Length, 0.3048};
+
+inline constexpr Unit m2{Dimension::Area, 1.0};
+inline constexpr Unit cm2{Dimension::Area, 1e-4};
+inline constexpr Unit in2{Dimension::Area, 0.00064516};
+inline constexpr Unit ft2{Dimension::Area, 0.092903};
+
+inline constexpr Unit m3{Dimension::Volume, 1.0};
+inline constexpr Unit dm3{Dimension::Volume, 1e-3};
+inline constexpr Unit L{Dimension::Volume, 1e-3};
+inline constexpr Unit cm3{Dimension::Volume, 1e-6};
+inline constexpr Unit in3{Dimension::Volume, 1.63871e-5};
+inline constexpr Unit ft3{Dimension::Volume, 0.0283168};
+
+inline constexpr Unit kg{Dimension::Mass, 1.0};
+inline constexpr Unit g{Dimension::Mass, 1e-3};
+inline constexpr Unit oz{Dimension::Mass, 0.0283495};
+inline constexpr Unit lb{Dimension::Mass, 0.453592};
+}
+
+/**
+ * @class Quantity
+ * @brief A value of one dimension, stored in the SI unit.
+ *
+ * @details The dimension is part of the type, so a length cannot be passed where a
+ * volume is expected. With a unit known at compile time (`of<Units::mm>()`,
+ * `in<Units::L>()`) the dimension is checked by the compiler and the conversion is
+ * a constant factor; a `Quantity` has the size of a `double`.
+ */
+template<Dimension D>
+class Quantity
+{
+public:
+    /// Zero.
+    constexpr Quantity() = default;
+
+    /**
+     * @brief Creates a quantity from a value in a unit known at run time, e.g. from `SIConverter::parse()`.
+     * @throws SiVAL::Exceptions::UnknownUnit If the unit has another dimension.
+     */
+    Quantity(double value, Unit unit);
+
+    /// Creates a quantity from a value in a unit known at compile time.
+    template<Unit U>
+    static constexpr Quantity of(double value) {
+        static_assert(U.dimension == D, "The unit has another dimension than the quantity.");
+        return Quantity(U.toSI(value), Tag());
+    }
+
+    /// Creates a quantity from a value in the SI unit.
+    static constexpr Quantity si(double value) {
+        return Quantity(value, Tag());
+    }
+
+    /// Returns the value in the SI unit.
+    constexpr double si() const {
+        return m_value;
+    }
+
+    /// Returns the value in a unit known at compile time.
+    template<Unit U>
+    constexpr double in() const {
+        static_assert(U.dimension == D, "The unit has another dimension than the quantity.");
+        return U.fromSI(m_value);
+    }
+
+    constexpr Quantity operator+(Quantity other) const {
+        return Quantity(m_value + other.m_value, Tag());
+    }
+    constexpr Quantity operator-(Quantity other) const {
+        return Quantity(m_value - other.m_value, Tag());
+    }
+    constexpr Quantity operator*(double scale) const {
+        return Quantity(m_value * scale, Tag());
+    }
+    constexpr Quantity operator/(double scale) const {
+        return Quantity(m_value / scale, Tag());
+    }
+    constexpr auto operator<=>(const Quantity&) const = default;
+
+private:
+    struct Tag {};
+    constexpr Quantity(double value, Tag)
+        : m_value(value) {
+    }
+
+    double m_value = 0.0;
+};
+
+using Length = Quantity<Dimension::Length>;
+using Area = Quantity<Dimension::Area>;
+using Volume = Quantity<Dimension::Volume>;
+using Mass = Quantity<Dimension::Mass>;
+
 /**
  * @class SIConverter
  * @brief A utility class providing static methods for unit conversions.
@@ -46,6 +184,26 @@ namespace SiVAL::Utils {
  */
 class LIB_SIVAL_EXPORT SIConverter {
 public:
+    /**
+     * @brief Returns the name of a dimension (e.g. "length").
+     */
+    static const char* name(Dimension dimension);
+
+    /**
+     * @brief Looks up a unit string, e.g. "mm" or "cm2".
+     * @details The accepted strings are those of the tables of `toArea()`, `toMass()`,
+     * `toLength()` and `toVolume()`. Parse a unit once and keep the `Unit` instead of
+     * the string when many values share it.
+     * @throws SiVAL::Exceptions::UnknownUnit If the string is no known unit.
+     */
+    static Unit parse(std::string_view unit);
+
+    /**
+     * @brief Looks up a unit string of a given dimension.
+     * @throws SiVAL::Exceptions::UnknownUnit If the string is no known unit of the dimension.
+     */
+    static Unit parse(std::string_view unit, Dimension dimension);
+
     /**
      * @brief Converts an area value from a specified unit to square meters (m²)   ($$\text{m}^2$$).
      * @details This function takes a numerical area value and a string representing its unit,
@@ -61,6 +219,7 @@ public:
      *
      * @param value The numerical value of the area.
      * @param unit The unit of the area as a string.
+     * @throws SiVAL::Exceptions::UnknownUnit If the unit is not in the table.
      * @return The area converted to square meters.
      */
     static double toArea(double value, const std::string& unit);
@@ -80,6 +239,7 @@ public:
      *
      * @param value The numerical value of the mass.
      * @param unit The unit of the mass as a string.
+     * @throws SiVAL::Exceptions::UnknownUnit If the unit is not in the table.
      * @return The mass converted to kilograms.
      */
     static double toMass(double value, const std::string& unit);
@@ -100,6 +260,7 @@ public:
      *
      * @param value The numerical value of the length.
      * @param unit The unit of the length as a string.
+     * @throws SiVAL::Exceptions::UnknownUnit If the unit is not in the table.
      * @return The length converted to meters.
      */
     static double toLength(double value, const std::string& unit);
@@ -121,8 +282,45 @@ public:
      *
      * @param value The numerical value of the volume.
      * @param unit The unit of the volume as a string.
+     * @throws SiVAL::Exceptions::UnknownUnit If the unit is not in the table.
      * @return The volume converted to cubic meters.
      */
     static double toVolume(double value, const std::string& unit);
+
+    /**
+     * @brief Converts a column of values in one unit to SI, in place.
+     * @details One multiplication per value in a loop the compiler vectorises.
+     */
+    static void toSI(std::span<double> values, Unit unit);
+
+    /**
+     * @brief Converts a column of values, each with its own unit string, to SI in place.
+     * @details Every distinct unit string is parsed once, however the units are mixed
+     * (e.g. `mm, in, mm, in, ...`): the first pass assigns every value to the group of
+     * its unit, which costs one string comparison if the unit repeats the one of the
+     * previous value and otherwise a lookup among the units seen so far, and a second
+     * pass multiplies each value by the factor of its group. A column with a single unit
+     * is scaled like `toSI(values, unit)`. All units are checked before any value is
+     * changed.
+     * @param values The values, converted in place.
+     * @param units The unit of every value, as long as `values`.
+     * @param dimension The dimension all units must have.
+     * @throws SiVAL::Exceptions::OutOfRange If the spans differ in length.
+     * @throws SiVAL::Exceptions::UnknownUnit If a unit is unknown or has another dimension.
+     */
+    static void toSI(std::span<double> values, std::span<const std::string_view> units, Dimension dimension);
+
+    /**
+     * @brief Like `toSI(std::span<double>, std::span<const std::string_view>, Dimension)` for owned strings.
+     */
+    static void toSI(std::span<double> values, std::span<const std::string> units, Dimension dimension);
 };
+
+template<Dimension D>
+Quantity<D>::Quantity(double value, Unit unit)
+    : m_value(unit.toSI(value)) {
+    if (unit.dimension != D) {
+        throw SiVAL::Exceptions::UnknownUnit(std::string("The unit is no unit of ") + SIConverter::name(D) + ".");
+    }
+}
 }
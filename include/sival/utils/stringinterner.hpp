@@ -0,0 +1,111 @@
+#pragma once
+
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ *
+ */
+//// begin system includes
+#include <cstddef>
+#include <functional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+//// end system includes
+
+//// begin project specific includes
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin forward declarations
+//// end forward declarations
+
+//// begin extern declaration
+//// end extern declaration
+
+namespace SiVAL::Utils {
+/**
+ * @class StringInterner
+ * @brief Keeps one copy of every distinct string.
+ *
+ * @details `intern()` returns a reference to the stored copy of a text, equal
+ * texts share the same copy. The references stay valid as long as the interner
+ * exists; strings are never removed. This suits values that repeat across many
+ * objects, e.g. the brands and materials of thousands of drivers, which then cost
+ * one pointer per object instead of one string.
+ *
+ * All methods are thread-safe. Lookups of known strings only take a shared lock.
+ */
+class LIB_SIVAL_EXPORT StringInterner
+{
+
+    //// begin public member methods
+public:
+    /// Constructor (empty interner)
+    StringInterner();
+    StringInterner(const StringInterner&) = delete;
+    StringInterner& operator=(const StringInterner&) = delete;
+    /// Destructor
+    ~StringInterner();
+
+    /**
+     * @brief Returns the interner shared by the whole library (e.g. by `AbstractDriver`).
+     */
+    static StringInterner& global();
+
+    /**
+     * @brief Returns the stored copy of a text, storing it first if it is new.
+     */
+    const std::string& intern(std::string_view text);
+
+    /**
+     * @brief Returns the number of distinct strings.
+     */
+    std::size_t size() const;
+    //// end public member methods
+
+    //// begin public member methods (internal use only)
+public:
+    //// end public member methods (internal use only)
+
+    //// begin protected member methods
+protected:
+    //// end protected member methods
+
+    //// begin protected member methods (internal use only)
+protected:
+    //// end protected member methods (internal use only)
+
+    //// begin private member methods
+private:
+    struct Hash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view text) const;
+    };
+    //// end private member methods
+
+    //// begin public member
+public:
+    //// end public member
+
+    //// begin protected member
+protected:
+    //// end protected member
+
+    //// begin private member
+private:
+    mutable std::shared_mutex m_mutex;
+    // Die Knoten eines unordered_set bleiben beim Rehash an ihrer Adresse
+    std::unordered_set<std::string, Hash, std::equal_to<>> m_strings;
+    //// end private member
+};
+}
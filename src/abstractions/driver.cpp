@@ -13,11 +13,17 @@
 //// end includes
 
 //// begin system includes
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <string_view>
 //// end system includes
 
 //// begin project specific includes
 #include <sival/abstractions/driver.hpp>
+#include <sival/core/exceptions.hpp>
 #include "sival/utils/siconverter.hpp"
+#include <sival/utils/stringinterner.hpp>
 //// end project specific includes
 
 //// begin using namespaces
@@ -35,12 +41,584 @@ using json = nlohmann::json;
 //// end static definitions
 
 //// begin static functions
+/**
+ * @brief Returns the shared copy of a text in the global interner.
+ */
+static const std::string* intern(std::string_view text) {
+    return &StringInterner::global().intern(text);
+}
+
+/**
+ * @brief Reads a value with its unit string as a quantity of the dimension of `Q`.
+ * @throws SiVAL::Exceptions::UnknownUnit If the unit is unknown or has another dimension.
+ */
+template<class Q>
+static Q quantity(double value, std::string_view unit) {
+    return Q(value, SIConverter::parse(unit));
+}
 //// end static functions
 
 namespace SiVAL {
 
+/**
+ * @brief The descriptive data of a driver, allocated apart from the numbers.
+ * @details Texts that repeat across drivers point into the global interner.
+ */
+struct AbstractDriver::Metadata {
+    Metadata()
+        : brand(empty()),
+        manufacturer(empty()),
+        providedBy(empty()),
+        speakerType(empty()),
+        nominalDiameter(empty()),
+        material(empty()) {
+    }
+
+    static const std::string* empty() {
+        static const std::string* text = intern("");
+        return text;
+    }
+
+    std::string uuid;
+    std::string comment;
+    std::string model;
+    const std::string* brand;
+    const std::string* manufacturer;
+    const std::string* providedBy;
+    const std::string* speakerType;
+    const std::string* nominalDiameter;
+    const std::string* material;
+    bool indexed = false;
+};
+
+/**
+ * @brief SAX handler of the streaming constructor.
+ *
+ * @details Every key is resolved into an entry of the field tables when it is read,
+ * so the values need no further lookup. The parts of a `{"value", "unit"}` object
+ * are collected and written with their unit conversion when the object ends.
+ * Unknown keys are skipped together with everything below them.
+ */
+class AbstractDriver::Reader
+{
+public:
+    /// Converts a value in a unit to SI, checking the dimension of the field.
+    using Conversion = double (*)(double, Unit);
+
+    /// The way a field is stored.
+    enum class Kind {
+        Text,             ///< A string.
+        Interned,         ///< A string that repeats across drivers.
+        Flag,             ///< A boolean.
+        Value,            ///< `{"value"}` without unit conversion.
+        Quantity,         ///< `{"value", "unit"}` with unit conversion.
+        OptionalQuantity, ///< Like `Quantity`, may be `null`.
+        Coil              ///< The `voice_coil` object.
+    };
+
+    /// One known key of a section.
+    struct Field {
+        const char* key;
+        Kind kind;
+        bool required;
+        std::string Metadata::* text = nullptr;
+        const std::string* Metadata::* interned = nullptr;
+        bool Metadata::* flag = nullptr;
+        double Parameters::* value = nullptr;
+        std::optional<double> Parameters::* optional = nullptr;
+        Conversion convert = nullptr;
+        bool Provided::* provided = nullptr;
+    };
+
+    /// One section of the root object.
+    struct Section {
+        const char* key;
+        const Field* fields;
+        std::size_t count;
+    };
+
+    explicit Reader(AbstractDriver &driver)
+        : m_driver(driver) {
+    }
+
+    bool null() {
+        if (skipping() || m_depth != 2 || m_field == nullptr) {
+            return scalar();
+        }
+        if (m_field->kind == Kind::OptionalQuantity) {
+            m_driver.m_parameters.*(m_field->optional) = std::nullopt;
+            found();
+            return true;
+        }
+        if (m_field->kind == Kind::Coil) {
+            return true;
+        }
+        return scalar();
+    }
+    bool boolean(bool value) {
+        if (!skipping() && m_depth == 2 && m_field != nullptr && m_field->kind == Kind::Flag) {
+            (*m_driver.m_metadata).*(m_field->flag) = value;
+            found();
+            return true;
+        }
+        return scalar();
+    }
+    bool number_integer(nlohmann::json::number_integer_t value) {
+        return number(static_cast<double>(value));
+    }
+    bool number_unsigned(nlohmann::json::number_unsigned_t value) {
+        return number(static_cast<double>(value));
+    }
+    bool number_float(nlohmann::json::number_float_t value, const std::string&) {
+        return number(value);
+    }
+    bool string(std::string &value) {
+        if (skipping()) {
+            return true;
+        }
+        if (m_depth == 2 && m_field != nullptr && m_field->kind == Kind::Text) {
+            (*m_driver.m_metadata).*(m_field->text) = std::move(value);
+            found();
+            return true;
+        }
+        if (m_depth == 2 && m_field != nullptr && m_field->kind == Kind::Interned) {
+            (*m_driver.m_metadata).*(m_field->interned) = intern(value);
+            found();
+            return true;
+        }
+        if (m_depth == 3 && m_field != nullptr && m_part == Part::Unit) {
+            if (m_field->convert != nullptr) {
+                try {
+                    m_unit = SIConverter::parse(value);
+                } catch (const SiVAL::Exceptions::UnknownUnit &e) {
+                    unitError(e);
+                }
+                m_hasUnit = true;
+            }
+            return true;
+        }
+        if (m_depth == 3 && m_field != nullptr && m_part == Part::Model) {
+            m_coilModel = value;
+            m_hasModel = true;
+            return true;
+        }
+        if (m_depth == 4 && m_coilPart == Part::Unit) {
+            return true;
+        }
+        return scalar();
+    }
+    bool binary(nlohmann::json::binary_t&) {
+        return scalar();
+    }
+    bool start_object(std::size_t) {
+        return open();
+    }
+    bool start_array(std::size_t) {
+        // Arrays kommen im Schema nicht vor
+        if (!skipping()) {
+            if (expected()) {
+                wrongType();
+            }
+            m_skip = m_depth;
+        }
+        ++m_depth;
+        return true;
+    }
+    bool end_object() {
+        return close();
+    }
+    bool end_array() {
+        return close();
+    }
+    bool key(std::string &key) {
+        if (skipping()) {
+            return true;
+        }
+        switch (m_depth) {
+        case 1:
+            m_section = nullptr;
+            for (const Section &section : sections()) {
+                if (key == section.key) {
+                    m_section = &section;
+                    break;
+                }
+            }
+            break;
+        case 2:
+            m_field = nullptr;
+            if (m_section != nullptr) {
+                for (std::size_t i = 0; i < m_section->count; ++i) {
+                    if (key == m_section->fields[i].key) {
+                        m_field = &m_section->fields[i];
+                        break;
+                    }
+                }
+            }
+            break;
+        case 3:
+            m_part = Part::None;
+            if (m_field == nullptr) {
+                break;
+            }
+            if (m_field->kind == Kind::Coil) {
+                if (key == "model") {
+                    m_part = Part::Model;
+                    break;
+                }
+                for (std::size_t i = 0; i < kCoilParameters; ++i) {
+                    if (key == coilParameters()[i].key) {
+                        m_part = Part::CoilParameter;
+                        m_coilParameter = i;
+                        break;
+                    }
+                }
+            } else if (key == "value") {
+                m_part = Part::Value;
+            } else if (key == "unit") {
+                m_part = Part::Unit;
+            }
+            break;
+        case 4:
+            m_coilPart = key == "value" ? Part::Value : (key == "unit" ? Part::Unit : Part::None);
+            break;
+        default:
+            break;
+        }
+        return true;
+    }
+    template<class Exception>
+    bool parse_error(std::size_t, const std::string&, const Exception &error) {
+        throw error;
+    }
+
+    /**
+     * @brief Checks the required fields, completes the voice coil and derives the missing parameters.
+     */
+    void finish() {
+        for (std::size_t s = 0; s < sections().size(); ++s) {
+            const Section &section = sections()[s];
+            for (std::size_t i = 0; i < section.count; ++i) {
+                if (section.fields[i].required && !(m_found & bit(s, i))) {
+                    throw SiVAL::Exceptions::OutOfRange(std::string("Driver data lacks the field ") + section.key + "." +
+                                                        section.fields[i].key);
+                }
+            }
+        }
+
+        SiVAL::VoiceCoil &coil = m_driver.m_parameters.voiceCoil;
+        coil.le = m_driver.m_parameters.le;
+        if (m_hasCoil) {
+            if (!m_hasModel) {
+                throw SiVAL::Exceptions::OutOfRange("Driver data lacks the field electrical_parameters.voice_coil.model");
+            }
+            coil.model = VoiceCoil::modelFromString(m_coilModel);
+            const char* needed[4] = {};
+            switch (coil.model) {
+            case VoiceCoil::Model::Simple:
+                break;
+            case VoiceCoil::Model::LR2:
+                needed[0] = "r2";
+                needed[1] = "l2";
+                break;
+            case VoiceCoil::Model::Wright:
+                needed[0] = "krm";
+                needed[1] = "erm";
+                needed[2] = "kxm";
+                needed[3] = "exm";
+                break;
+            case VoiceCoil::Model::Leach:
+                needed[0] = "k";
+                needed[1] = "n";
+                break;
+            }
+            for (const char* name : needed) {
+                if (name == nullptr) {
+                    continue;
+                }
+                for (std::size_t i = 0; i < kCoilParameters; ++i) {
+                    if (std::string_view(name) == coilParameters()[i].key && !(m_coilFound & (1u << i))) {
+                        throw SiVAL::Exceptions::OutOfRange(
+                            std::string("Driver data lacks the field electrical_parameters.voice_coil.") + name);
+                    }
+                }
+            }
+        }
+        m_driver.deriveParameters(m_provided);
+    }
+
+private:
+    /// The meaning of a key below a field.
+    enum class Part {
+        None,
+        Value,
+        Unit,
+        Model,
+        CoilParameter
+    };
+
+    struct CoilParameter {
+        const char* key;
+        double SiVAL::VoiceCoil::* member;
+    };
+    static constexpr std::size_t kCoilParameters = 8;
+    static constexpr std::size_t kFieldsPerSection = 16;
+
+    static const std::array<Section, 4>& sections() {
+        static const Field general[] = {
+            {.key = "uuid", .kind = Kind::Text, .required = true, .text = &Metadata::uuid},
+            {.key = "brand", .kind = Kind::Interned, .required = true, .interned = &Metadata::brand},
+            {.key = "manufacturer", .kind = Kind::Interned, .required = true, .interned = &Metadata::manufacturer},
+            {.key = "providedby", .kind = Kind::Interned, .required = true, .interned = &Metadata::providedBy},
+            {.key = "comment", .kind = Kind::Text, .required = true, .text = &Metadata::comment},
+            {.key = "model", .kind = Kind::Text, .required = true, .text = &Metadata::model},
+            {.key = "indexed", .kind = Kind::Flag, .required = true, .flag = &Metadata::indexed},
+            {.key = "speaker_type", .kind = Kind::Interned, .required = false, .interned = &Metadata::speakerType},
+        };
+        static const Field electrical[] = {
+            {.key = "re", .kind = Kind::Value, .required = true, .value = &Parameters::re},
+            {.key = "bl", .kind = Kind::Value, .required = true, .value = &Parameters::bl},
+            {.key = "impedance", .kind = Kind::Value, .required = true, .value = &Parameters::impedance},
+            {.key = "le", .kind = Kind::Value, .required = true, .value = &Parameters::le},
+            {.key = "znom", .kind = Kind::Value, .required = true, .value = &Parameters::znom},
+            {.key = "pe", .kind = Kind::Value, .required = true, .value = &Parameters::pe},
+            {.key = "pmax", .kind = Kind::Value, .required = true, .value = &Parameters::pmax},
+            {.key = "motor_constant", .kind = Kind::Value, .required = true, .value = &Parameters::motorConstant},
+            {.key = "flux_density", .kind = Kind::Value, .required = true, .value = &Parameters::fluxDensity},
+            {.key = "sensitivity", .kind = Kind::Value, .required = false, .value = &Parameters::sensitivity,
+             .provided = &Provided::sensitivity},
+            {.key = "voice_coil", .kind = Kind::Coil, .required = false},
+        };
+        static const Field thieleSmall[] = {
+            {.key = "fs", .kind = Kind::Value, .required = true, .value = &Parameters::fs},
+            {.key = "qms", .kind = Kind::Value, .required = true, .value = &Parameters::qms},
+            {.key = "mms", .kind = Kind::Quantity, .required = true, .value = &Parameters::mms,
+             .convert = toSI<Mass>},
+            {.key = "sd", .kind = Kind::Quantity, .required = true, .value = &Parameters::sd,
+             .convert = toSI<Area>},
+            {.key = "mmd", .kind = Kind::Quantity, .required = true, .value = &Parameters::mmd,
+             .convert = toSI<Mass>},
+            {.key = "rms", .kind = Kind::Value, .required = true, .value = &Parameters::rms},
+            {.key = "xmax", .kind = Kind::OptionalQuantity, .required = false, .optional = &Parameters::xmax,
+             .convert = toSI<Length>},
+            {.key = "xlim", .kind = Kind::OptionalQuantity, .required = false, .optional = &Parameters::xlim,
+             .convert = toSI<Length>},
+            {.key = "qes", .kind = Kind::Value, .required = false, .value = &Parameters::qes,
+             .provided = &Provided::qes},
+            {.key = "qts", .kind = Kind::Value, .required = false, .value = &Parameters::qts,
+             .provided = &Provided::qts},
+            {.key = "cms", .kind = Kind::Value, .required = false, .value = &Parameters::cms,
+             .provided = &Provided::cms},
+            {.key = "stiffness", .kind = Kind::Value, .required = false, .value = &Parameters::stiffness,
+             .provided = &Provided::stiffness},
+            {.key = "vas", .kind = Kind::Quantity, .required = false, .value = &Parameters::vas,
+             .convert = toSI<Volume>, .provided = &Provided::vas},
+            {.key = "vd", .kind = Kind::OptionalQuantity, .required = false, .optional = &Parameters::vd,
+             .convert = toSI<Volume>, .provided = &Provided::vd},
+        };
+        static const Field physical[] = {
+            {.key = "nominal_diameter", .kind = Kind::Interned, .required = true, .interned = &Metadata::nominalDiameter},
+            {.key = "vc_diameter", .kind = Kind::Quantity, .required = true, .value = &Parameters::vcDiameter,
+             .convert = toSI<Length>},
+            {.key = "winding_height", .kind = Kind::Quantity, .required = true,
+             .value = &Parameters::windingHeight, .convert = toSI<Length>},
+            {.key = "air_gap_height", .kind = Kind::Quantity, .required = true,
+             .value = &Parameters::airGapHeight, .convert = toSI<Length>},
+            {.key = "effective_diameter", .kind = Kind::Quantity, .required = true,
+             .value = &Parameters::effectiveDiameter, .convert = toSI<Length>},
+            {.key = "baffle_cutout_diameter", .kind = Kind::Quantity, .required = true,
+             .value = &Parameters::baffleCutoutDiameter, .convert = toSI<Length>},
+            {.key = "volume_occupied", .kind = Kind::Quantity, .required = true,
+             .value = &Parameters::volumeOccupied, .convert = toSI<Volume>},
+            {.key = "net_weight", .kind = Kind::Quantity, .required = true, .value = &Parameters::netWeight,
+             .convert = toSI<Mass>},
+            {.key = "material", .kind = Kind::Interned, .required = true, .interned = &Metadata::material},
+        };
+        static const std::array<Section, 4> table = {{
+            {"general_info", general, std::size(general)},
+            {"electrical_parameters", electrical, std::size(electrical)},
+            {"thiele_small_parameters", thieleSmall, std::size(thieleSmall)},
+            {"physical_dimensions", physical, std::size(physical)},
+        }};
+        return table;
+    }
+    static const CoilParameter* coilParameters() {
+        static const CoilParameter table[kCoilParameters] = {
+            {"r2", &SiVAL::VoiceCoil::r2}, {"l2", &SiVAL::VoiceCoil::l2},
+            {"krm", &SiVAL::VoiceCoil::krm}, {"erm", &SiVAL::VoiceCoil::erm},
+            {"kxm", &SiVAL::VoiceCoil::kxm}, {"exm", &SiVAL::VoiceCoil::exm},
+            {"k", &SiVAL::VoiceCoil::k}, {"n", &SiVAL::VoiceCoil::n},
+        };
+        return table;
+    }
+    static std::uint64_t bit(std::size_t section, std::size_t field) {
+        return std::uint64_t(1) << (section * kFieldsPerSection + field);
+    }
+
+    bool skipping() const {
+        return m_skip >= 0;
+    }
+    /// True if the current key names a known section or field, which then has the wrong type.
+    bool expected() const {
+        return (m_depth == 1 && m_section != nullptr) || (m_depth == 2 && m_field != nullptr) ||
+               (m_depth == 3 && m_field != nullptr && m_part != Part::None);
+    }
+    /// The SI value of a quantity of the dimension of `Q`.
+    template<class Q>
+    static double toSI(double value, Unit unit) {
+        return Q(value, unit).si();
+    }
+    [[noreturn]] void unitError(const SiVAL::Exceptions::UnknownUnit &error) const {
+        throw SiVAL::Exceptions::UnknownUnit(std::string(error.what()) + " at " + m_section->key + "." + m_field->key);
+    }
+    [[noreturn]] void wrongType() const {
+        std::string path = m_section != nullptr ? m_section->key : "";
+        if (m_depth >= 2 && m_field != nullptr) {
+            path += std::string(".") + m_field->key;
+        }
+        throw SiVAL::Exceptions::OutOfRange("Driver data has the wrong type at " + path);
+    }
+    void found() {
+        const std::size_t s = static_cast<std::size_t>(m_section - sections().data());
+        const std::size_t i = static_cast<std::size_t>(m_field - m_section->fields);
+        m_found |= bit(s, i);
+        if (m_field->provided != nullptr) {
+            m_provided.*(m_field->provided) = true;
+        }
+    }
+    bool scalar() {
+        if (!skipping() && expected()) {
+            wrongType();
+        }
+        return true;
+    }
+    bool number(double value) {
+        if (skipping()) {
+            return true;
+        }
+        if (m_depth == 3 && m_field != nullptr && m_part == Part::Value) {
+            m_value = value;
+            m_hasValue = true;
+            return true;
+        }
+        if (m_depth == 4 && m_coilPart == Part::Value) {
+            m_value = value;
+            m_hasValue = true;
+            return true;
+        }
+        return scalar();
+    }
+    bool open() {
+        if (!skipping()) {
+            bool wanted = false;
+            switch (m_depth) {
+            case 0:
+                wanted = true;
+                break;
+            case 1:
+                wanted = m_section != nullptr;
+                m_field = nullptr;
+                break;
+            case 2:
+                wanted = m_field != nullptr && m_field->kind != Kind::Text && m_field->kind != Kind::Interned &&
+                         m_field->kind != Kind::Flag;
+                if (m_field != nullptr && !wanted) {
+                    wrongType();
+                }
+                m_part = Part::None;
+                m_hasValue = false;
+                m_hasUnit = false;
+                break;
+            case 3:
+                wanted = m_part == Part::CoilParameter;
+                if (m_part != Part::None && !wanted) {
+                    wrongType();
+                }
+                m_coilPart = Part::None;
+                m_hasValue = false;
+                break;
+            default:
+                break;
+            }
+            if (!wanted) {
+                m_skip = m_depth;
+            }
+        }
+        ++m_depth;
+        return true;
+    }
+    bool close() {
+        --m_depth;
+        if (skipping()) {
+            if (m_depth == m_skip) {
+                m_skip = -1;
+            }
+            return true;
+        }
+        if (m_depth == 2 && m_field != nullptr) {
+            commit();
+        } else if (m_depth == 3 && m_part == Part::CoilParameter) {
+            if (!m_hasValue) {
+                throw SiVAL::Exceptions::OutOfRange(std::string("Driver data lacks the value of electrical_parameters.voice_coil.") +
+                                                    coilParameters()[m_coilParameter].key);
+            }
+            m_driver.m_parameters.voiceCoil.*(coilParameters()[m_coilParameter].member) = m_value;
+            m_coilFound |= 1u << m_coilParameter;
+        }
+        return true;
+    }
+    /// Writes the collected value of a field object into the driver.
+    void commit() {
+        if (m_field->kind == Kind::Coil) {
+            m_hasCoil = true;
+            return;
+        }
+        const std::string name = std::string(m_section->key) + "." + m_field->key;
+        if (!m_hasValue) {
+            throw SiVAL::Exceptions::OutOfRange("Driver data lacks the value of " + name);
+        }
+        double value = m_value;
+        if (m_field->convert != nullptr) {
+            if (!m_hasUnit) {
+                throw SiVAL::Exceptions::OutOfRange("Driver data lacks the unit of " + name);
+            }
+            try {
+                value = m_field->convert(value, m_unit);
+            } catch (const SiVAL::Exceptions::UnknownUnit &e) {
+                unitError(e);
+            }
+        }
+        if (m_field->kind == Kind::OptionalQuantity) {
+            m_driver.m_parameters.*(m_field->optional) = value;
+        } else {
+            m_driver.m_parameters.*(m_field->value) = value;
+        }
+        found();
+    }
+
+    AbstractDriver &m_driver;
+    Provided m_provided;
+    std::uint64_t m_found = 0;
+    unsigned m_coilFound = 0;
+    int m_depth = 0;
+    int m_skip = -1;
+    const Section* m_section = nullptr;
+    const Field* m_field = nullptr;
+    Part m_part = Part::None;
+    Part m_coilPart = Part::None;
+    std::size_t m_coilParameter = 0;
+    double m_value = 0.0;
+    bool m_hasValue = false;
+    bool m_hasUnit = false;
+    Unit m_unit = Units::m;
+    bool m_hasCoil = false;
+    bool m_hasModel = false;
+    std::string m_coilModel;
+};
+
+
 //// begin public member methods
-AbstractDriver::AbstractDriver(nlohmann::json &data) {
+AbstractDriver::AbstractDriver(nlohmann::json &data)
+    : m_metadata(std::make_unique<Metadata>()) {
     // Wird nicht mehr benötigt, da das ganze jetzt über die DriverFactory erledigt wird.
     //
     // std::ifstream file(json);
@@ -53,7 +631,7 @@ AbstractDriver::AbstractDriver(nlohmann::json &data) {
     // Helper lambda to safely get a value-unit pair and convert it
     auto getConvertedValue = [&](const nlohmann::json& parent, const std::string& key, auto converter) -> double {
         const auto& obj = parent.at(key);
-        return converter(obj.at("value").get<double>(), obj.at("unit").get<std::string>());
+        return converter(obj.at("value").get<double>(), obj.at("unit").get<std::string>()).si();
     };
 
     // Helper for optional value-unit pairs
@@ -62,7 +640,7 @@ AbstractDriver::AbstractDriver(nlohmann::json &data) {
             return std::nullopt;
         }
         const auto& obj = parent.at(key);
-        return converter(obj.at("value").get<double>(), obj.at("unit").get<std::string>());
+        return converter(obj.at("value").get<double>(), obj.at("unit").get<std::string>()).si();
     };
 
     // --- Step 1: Read all fundamental, non-calculable parameters ---
@@ -70,305 +648,351 @@ AbstractDriver::AbstractDriver(nlohmann::json &data) {
 
     // General Info
     const auto& gi = data.at("general_info");
-    m_uuid = gi.at("uuid").get<std::string>();
-    m_brand = gi.at("brand").get<std::string>();
-    m_manufacturer = gi.at("manufacturer").get<std::string>();
-    m_providedby = gi.at("providedby").get<std::string>();
-    m_comment = gi.at("comment").get<std::string>();
-    m_model = gi.at("model").get<std::string>();
-    m_indexed = gi.at("indexed").get<bool>();
-    m_speaker_type = gi.value("speaker_type", "");
+    m_metadata->uuid = gi.at("uuid").get<std::string>();
+    m_metadata->brand = intern(gi.at("brand").get<std::string>());
+    m_metadata->manufacturer = intern(gi.at("manufacturer").get<std::string>());
+    m_metadata->providedBy = intern(gi.at("providedby").get<std::string>());
+    m_metadata->comment = gi.at("comment").get<std::string>();
+    m_metadata->model = gi.at("model").get<std::string>();
+    m_metadata->indexed = gi.at("indexed").get<bool>();
+    m_metadata->speakerType = intern(gi.value("speaker_type", ""));
 
     // Fundamental Electrical Parameters
     const auto& ep = data.at("electrical_parameters");
-    m_re = ep.at("re").at("value").get<double>();
-    m_bl = ep.at("bl").at("value").get<double>();
+    m_parameters.re = ep.at("re").at("value").get<double>();
+    m_parameters.bl = ep.at("bl").at("value").get<double>();
 
     // Other Electrical Parameters (read directly)
-    m_impedance = ep.at("impedance").at("value").get<double>();
-    m_le = ep.at("le").at("value").get<double>();
-    m_znom = ep.at("znom").at("value").get<double>();
-    m_pe = ep.at("pe").at("value").get<double>();
-    m_pmax = ep.at("pmax").at("value").get<double>();
-    m_motor_constant = ep.at("motor_constant").at("value").get<double>();
-    m_flux_density = ep.at("flux_density").at("value").get<double>();
+    m_parameters.impedance = ep.at("impedance").at("value").get<double>();
+    m_parameters.le = ep.at("le").at("value").get<double>();
+    m_parameters.znom = ep.at("znom").at("value").get<double>();
+    m_parameters.pe = ep.at("pe").at("value").get<double>();
+    m_parameters.pmax = ep.at("pmax").at("value").get<double>();
+    m_parameters.motorConstant = ep.at("motor_constant").at("value").get<double>();
+    m_parameters.fluxDensity = ep.at("flux_density").at("value").get<double>();
+
+    // Optional voice coil model, without it Le is a single inductance
+    m_parameters.voiceCoil.le = m_parameters.le;
+    if (ep.contains("voice_coil") && !ep.at("voice_coil").is_null()) {
+        const auto& vc = ep.at("voice_coil");
+        m_parameters.voiceCoil.model = VoiceCoil::modelFromString(vc.at("model").get<std::string>());
+        switch (m_parameters.voiceCoil.model) {
+        case VoiceCoil::Model::Simple:
+            break;
+        case VoiceCoil::Model::LR2:
+            m_parameters.voiceCoil.r2 = vc.at("r2").at("value").get<double>();
+            m_parameters.voiceCoil.l2 = vc.at("l2").at("value").get<double>();
+            break;
+        case VoiceCoil::Model::Wright:
+            m_parameters.voiceCoil.krm = vc.at("krm").at("value").get<double>();
+            m_parameters.voiceCoil.erm = vc.at("erm").at("value").get<double>();
+            m_parameters.voiceCoil.kxm = vc.at("kxm").at("value").get<double>();
+            m_parameters.voiceCoil.exm = vc.at("exm").at("value").get<double>();
+            break;
+        case VoiceCoil::Model::Leach:
+            m_parameters.voiceCoil.k = vc.at("k").at("value").get<double>();
+            m_parameters.voiceCoil.n = vc.at("n").at("value").get<double>();
+            break;
+        }
+    }
 
     // Fundamental Thiele-Small Parameters
     const auto& tsp = data.at("thiele_small_parameters");
-    m_fs = tsp.at("fs").at("value").get<double>();
-    m_qms = tsp.at("qms").at("value").get<double>();
-    m_mms_kg = getConvertedValue(tsp, "mms", SIConverter::toMass);
-    m_sd_m2 = getConvertedValue(tsp, "sd", SIConverter::toArea);
+    m_parameters.fs = tsp.at("fs").at("value").get<double>();
+    m_parameters.qms = tsp.at("qms").at("value").get<double>();
+    m_parameters.mms = getConvertedValue(tsp, "mms", quantity<Mass>);
+    m_parameters.sd = getConvertedValue(tsp, "sd", quantity<Area>);
 
     // Non-fundamental but directly read parameters
-    m_mmd_kg = getConvertedValue(tsp, "mmd", SIConverter::toMass);
-    m_rms = tsp.at("rms").at("value").get<double>();
-    m_xmax_m = getOptionalConvertedValue(tsp, "xmax", SIConverter::toLength);
-    m_xlim_m = getOptionalConvertedValue(tsp, "xlim", SIConverter::toLength);
+    m_parameters.mmd = getConvertedValue(tsp, "mmd", quantity<Mass>);
+    m_parameters.rms = tsp.at("rms").at("value").get<double>();
+    m_parameters.xmax = getOptionalConvertedValue(tsp, "xmax", quantity<Length>);
+    m_parameters.xlim = getOptionalConvertedValue(tsp, "xlim", quantity<Length>);
 
     // Physical Dimensions
     const auto& pd = data.at("physical_dimensions");
-    m_nominal_diameter = pd.at("nominal_diameter").get<std::string>();
-    m_vc_diameter_m = getConvertedValue(pd, "vc_diameter", SIConverter::toLength);
-    m_winding_height_m = getConvertedValue(pd, "winding_height", SIConverter::toLength);
-    m_air_gap_height_m = getConvertedValue(pd, "air_gap_height", SIConverter::toLength);
-    m_effective_diameter_m = getConvertedValue(pd, "effective_diameter", SIConverter::toLength);
-    m_baffle_cutout_diameter_m = getConvertedValue(pd, "baffle_cutout_diameter", SIConverter::toLength);
-    m_volume_occupied_m3 = getConvertedValue(pd, "volume_occupied", SIConverter::toVolume);
-    m_net_weight_kg = getConvertedValue(pd, "net_weight", SIConverter::toMass);
-    m_material = pd.at("material").get<std::string>();
+    m_metadata->nominalDiameter = intern(pd.at("nominal_diameter").get<std::string>());
+    m_parameters.vcDiameter = getConvertedValue(pd, "vc_diameter", quantity<Length>);
+    m_parameters.windingHeight = getConvertedValue(pd, "winding_height", quantity<Length>);
+    m_parameters.airGapHeight = getConvertedValue(pd, "air_gap_height", quantity<Length>);
+    m_parameters.effectiveDiameter = getConvertedValue(pd, "effective_diameter", quantity<Length>);
+    m_parameters.baffleCutoutDiameter = getConvertedValue(pd, "baffle_cutout_diameter", quantity<Length>);
+    m_parameters.volumeOccupied = getConvertedValue(pd, "volume_occupied", quantity<Volume>);
+    m_parameters.netWeight = getConvertedValue(pd, "net_weight", quantity<Mass>);
+    m_metadata->material = intern(pd.at("material").get<std::string>());
 
     // --- Step 2: Read or calculate derivable parameters ---
-    // The order is important due to dependencies.
-
+    Provided provided;
     if (tsp.contains("qes")) {
-        m_qes = tsp.at("qes").at("value").get<double>();
-    } else {
-        m_qes = calculateQes();
+        m_parameters.qes = tsp.at("qes").at("value").get<double>();
+        provided.qes = true;
     }
-
     if (tsp.contains("qts")) {
-        m_qts = tsp.at("qts").at("value").get<double>();
-    } else {
-        m_qts = calculateQts();
+        m_parameters.qts = tsp.at("qts").at("value").get<double>();
+        provided.qts = true;
     }
-
     if (tsp.contains("cms")) {
-        m_cms = tsp.at("cms").at("value").get<double>();
-    } else {
-        m_cms = calculateCms();
+        m_parameters.cms = tsp.at("cms").at("value").get<double>();
+        provided.cms = true;
     }
-
     if (tsp.contains("stiffness")) {
-        m_stiffness = tsp.at("stiffness").at("value").get<double>();
-    } else {
-        m_stiffness = calculateKms();
+        m_parameters.stiffness = tsp.at("stiffness").at("value").get<double>();
+        provided.stiffness = true;
     }
-
     if (tsp.contains("vas")) {
-        m_vas_m3 = getConvertedValue(tsp, "vas", SIConverter::toVolume);
-    } else {
-        m_vas_m3 = calculateVas();
+        m_parameters.vas = getConvertedValue(tsp, "vas", quantity<Volume>);
+        provided.vas = true;
     }
-
     if (tsp.contains("vd")) {
-        m_vd_m3 = getOptionalConvertedValue(tsp, "vd", SIConverter::toVolume);
-    } else {
-        m_vd_m3 = calculateVd();
+        m_parameters.vd = getOptionalConvertedValue(tsp, "vd", quantity<Volume>);
+        provided.vd = true;
     }
-
     if (ep.contains("sensitivity")) {
-        m_sensitivity = ep.at("sensitivity").at("value").get<double>();
-    } else {
-        m_sensitivity = calculateSensitivity();
+        m_parameters.sensitivity = ep.at("sensitivity").at("value").get<double>();
+        provided.sensitivity = true;
     }
+    deriveParameters(provided);
+}
+
+AbstractDriver::AbstractDriver(const char* begin, const char* end)
+    : m_metadata(std::make_unique<Metadata>()) {
+    Reader reader(*this);
+    nlohmann::json::sax_parse(begin, end, &reader);
+    reader.finish();
 }
 
+AbstractDriver::AbstractDriver(const AbstractDriver &other)
+    : m_parameters(other.m_parameters),
+    m_metadata(std::make_unique<Metadata>(*other.m_metadata)) {
+}
+
+AbstractDriver::AbstractDriver(AbstractDriver &&other) noexcept = default;
+
+AbstractDriver& AbstractDriver::operator=(const AbstractDriver &other) {
+    if (this != &other) {
+        m_parameters = other.m_parameters;
+        m_metadata = std::make_unique<Metadata>(*other.m_metadata);
+    }
+    return *this;
+}
+
+AbstractDriver& AbstractDriver::operator=(AbstractDriver &&other) noexcept = default;
+
 AbstractDriver::~AbstractDriver() = default;
 
+const AbstractDriver::Parameters& AbstractDriver::parameters() const
+{
+    return m_parameters;
+}
+
 const std::string& AbstractDriver::uuid() const
 {
-    return m_uuid;
+    return m_metadata->uuid;
 }
 
 const std::string& AbstractDriver::brand() const
 {
-    return m_brand;
+    return *m_metadata->brand;
 }
 
 const std::string& AbstractDriver::manufacturer() const
 {
-    return m_manufacturer;
+    return *m_metadata->manufacturer;
 }
 
 const std::string& AbstractDriver::providedBy() const
 {
-    return m_providedby;
+    return *m_metadata->providedBy;
 }
 
 const std::string& AbstractDriver::comment() const
 {
-    return m_comment;
+    return m_metadata->comment;
 }
 
 const std::string& AbstractDriver::model() const
 {
-    return m_model;
+    return m_metadata->model;
 }
 
 bool AbstractDriver::indexed() const
 {
-    return m_indexed;
+    return m_metadata->indexed;
 }
 
 const std::string& AbstractDriver::speakerType() const
 {
-    return m_speaker_type;
+    return *m_metadata->speakerType;
 }
 
 double AbstractDriver::impedance() const
 {
-    return m_impedance;
+    return m_parameters.impedance;
 }
 
 double AbstractDriver::sensitivity() const
 {
-    return m_sensitivity;
+    return m_parameters.sensitivity;
 }
 
 double AbstractDriver::re() const
 {
-    return m_re;
+    return m_parameters.re;
 }
 
 double AbstractDriver::le() const
 {
-    return m_le;
+    return m_parameters.le;
+}
+
+const SiVAL::VoiceCoil& AbstractDriver::voiceCoil() const
+{
+    return m_parameters.voiceCoil;
 }
 
 double AbstractDriver::znom() const
 {
-    return m_znom;
+    return m_parameters.znom;
 }
 
 double AbstractDriver::pe() const
 {
-    return m_pe;
+    return m_parameters.pe;
 }
 
 double AbstractDriver::pmax() const
 {
-    return m_pmax;
+    return m_parameters.pmax;
 }
 
 double AbstractDriver::bl() const
 {
-    return m_bl;
+    return m_parameters.bl;
 }
 
 double AbstractDriver::motorConstant() const
 {
-    return m_motor_constant;
+    return m_parameters.motorConstant;
 }
 
 double AbstractDriver::fluxDensity() const
 {
-    return m_flux_density;
+    return m_parameters.fluxDensity;
 }
 
 double AbstractDriver::fs() const
 {
-    return m_fs;
+    return m_parameters.fs;
 }
 
 double AbstractDriver::qms() const
 {
-    return m_qms;
+    return m_parameters.qms;
 }
 
 double AbstractDriver::qes() const
 {
-    return m_qes;
+    return m_parameters.qes;
 }
 
 double AbstractDriver::qts() const
 {
-    return m_qts;
+    return m_parameters.qts;
 }
 
 double AbstractDriver::mms() const
 {
-    return m_mms_kg;
+    return m_parameters.mms;
 }
 
 double AbstractDriver::mmd() const
 {
-    return m_mmd_kg;
+    return m_parameters.mmd;
 }
 
 double AbstractDriver::stiffness() const
 {
-    return m_stiffness;
+    return m_parameters.stiffness;
 }
 
 double AbstractDriver::cms() const
 {
-    return m_cms;
+    return m_parameters.cms;
 }
 
 double AbstractDriver::vas() const
 {
-    return m_vas_m3;
+    return m_parameters.vas;
 }
 
 double AbstractDriver::rms() const
 {
-    return m_rms;
+    return m_parameters.rms;
 }
 
 double AbstractDriver::sd() const
 {
-    return m_sd_m2;
+    return m_parameters.sd;
 }
 
 std::optional<double> AbstractDriver::xmax() const
 {
-    return m_xmax_m;
+    return m_parameters.xmax;
 }
 
 std::optional<double> AbstractDriver::xlim() const
 {
-    return m_xlim_m;
+    return m_parameters.xlim;
 }
 
 std::optional<double> AbstractDriver::vd() const
 {
-    return m_vd_m3;
+    return m_parameters.vd;
 }
 
 const std::string& AbstractDriver::nominalDiameter() const
 {
-    return m_nominal_diameter;
+    return *m_metadata->nominalDiameter;
 }
 
 double AbstractDriver::vcDiameter() const
 {
-    return m_vc_diameter_m;
+    return m_parameters.vcDiameter;
 }
 
 double AbstractDriver::windingHeight() const
 {
-    return m_winding_height_m;
+    return m_parameters.windingHeight;
 }
 
 double AbstractDriver::airGapHeight() const
 {
-    return m_air_gap_height_m;
+    return m_parameters.airGapHeight;
 }
 
 double AbstractDriver::effectiveDiameter() const
 {
-    return m_effective_diameter_m;
+    return m_parameters.effectiveDiameter;
 }
 
 double AbstractDriver::baffleCutoutDiameter() const
 {
-    return m_baffle_cutout_diameter_m;
+    return m_parameters.baffleCutoutDiameter;
 }
 
 double AbstractDriver::volumeOccupied() const
 {
-    return m_volume_occupied_m3;
+    return m_parameters.volumeOccupied;
 }
 
 double AbstractDriver::netWeight() const
 {
-    return m_net_weight_kg;
+    return m_parameters.netWeight;
 }
 
 const std::string& AbstractDriver::material() const
 {
-    return m_material;
+    return *m_metadata->material;
 }
 //// end public member methods
 
@@ -380,46 +1004,70 @@ const std::string& AbstractDriver::material() const
 
 //// begin protected member methods (internal use only)
 double AbstractDriver::calculateQes() const {
-    if (m_bl == 0) return 0; // Avoid division by zero
-    return (2 * SiVAL::PI * m_fs * m_mms_kg * m_re) / (m_bl * m_bl);
+    if (m_parameters.bl == 0) return 0; // Avoid division by zero
+    return (2 * SiVAL::PI * m_parameters.fs * m_parameters.mms * m_parameters.re) / (m_parameters.bl * m_parameters.bl);
 }
 
 double AbstractDriver::calculateQts() const {
-    if ((m_qms + m_qes) == 0) return 0; // Use the now-guaranteed-to-be-set m_qes
-    return (m_qms * m_qes) / (m_qms + m_qes);
+    if ((m_parameters.qms + m_parameters.qes) == 0) return 0; // Use the now-guaranteed-to-be-set m_parameters.qes
+    return (m_parameters.qms * m_parameters.qes) / (m_parameters.qms + m_parameters.qes);
 }
 
 double AbstractDriver::calculateCms() const {
-    const double term = 2 * SiVAL::PI * m_fs;
-    if (term == 0 || m_mms_kg == 0) return 0; // Avoid division by zero
-    return 1.0 / ((term * term) * m_mms_kg);
+    const double term = 2 * SiVAL::PI * m_parameters.fs;
+    if (term == 0 || m_parameters.mms == 0) return 0; // Avoid division by zero
+    return 1.0 / ((term * term) * m_parameters.mms);
 }
 
 double AbstractDriver::calculateKms() const {
-    const double term = 2 * SiVAL::PI * m_fs;
-    return (term * term) * m_mms_kg;
+    const double term = 2 * SiVAL::PI * m_parameters.fs;
+    return (term * term) * m_parameters.mms;
 }
 
 double AbstractDriver::calculateVas() const {
-    return RHO0 * SiVAL::C_SOUND * SiVAL::C_SOUND * m_sd_m2 * m_sd_m2 * m_cms; // Use the now-guaranteed-to-be-set m_cms
+    return RHO0 * SiVAL::C_SOUND * SiVAL::C_SOUND * m_parameters.sd * m_parameters.sd * m_parameters.cms; // Use the now-guaranteed-to-be-set m_parameters.cms
 }
 
 std::optional<double> AbstractDriver::calculateVd() const {
-    if (!m_xmax_m.has_value()) {
+    if (!m_parameters.xmax.has_value()) {
         return std::nullopt;
     }
-    return m_sd_m2 * m_xmax_m.value();
+    return m_parameters.sd * m_parameters.xmax.value();
 }
 
 double AbstractDriver::calculateSensitivity() const {
-    if (SiVAL::C_SOUND == 0 || m_qes == 0) return 0; // Avoid division by zero
+    if (SiVAL::C_SOUND == 0 || m_parameters.qes == 0) return 0; // Avoid division by zero
 
-    const double eta0 = (4 * SiVAL::PI * SiVAL::PI * std::pow(m_fs, 3) * m_vas_m3) / (std::pow(SiVAL::C_SOUND, 3) * m_qes);
+    const double eta0 = (4 * SiVAL::PI * SiVAL::PI * std::pow(m_parameters.fs, 3) * m_parameters.vas) / (std::pow(SiVAL::C_SOUND, 3) * m_parameters.qes);
 
     if (eta0 <= 0) return 0; // Logarithm is undefined for non-positive numbers
 
     return 112.0 + 10.0 * std::log10(eta0);
 }
+
+void AbstractDriver::deriveParameters(const Provided &provided) {
+    if (!provided.qes) {
+        m_parameters.qes = calculateQes();
+    }
+    if (!provided.qts) {
+        m_parameters.qts = calculateQts();
+    }
+    if (!provided.cms) {
+        m_parameters.cms = calculateCms();
+    }
+    if (!provided.stiffness) {
+        m_parameters.stiffness = calculateKms();
+    }
+    if (!provided.vas) {
+        m_parameters.vas = calculateVas(); // Use the now-guaranteed-to-be-set m_parameters.cms
+    }
+    if (!provided.vd) {
+        m_parameters.vd = calculateVd();
+    }
+    if (!provided.sensitivity) {
+        m_parameters.sensitivity = calculateSensitivity();
+    }
+}
 //// end protected member methods (internal use only)
 
 //// begin private member methods
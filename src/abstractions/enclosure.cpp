@@ -35,6 +35,26 @@ namespace SiVAL {
 //// begin public member methods
 AbstractEnclosure::~AbstractEnclosure() {
 }
+double AbstractEnclosure::baffleHeight() const {
+    return m_baffleHeight;
+}
+double AbstractEnclosure::baffleWidth() const {
+    return m_baffleWidth;
+}
+SiVAL::BafflePoint AbstractEnclosure::driverPosition(SiVAL::DriverRole role) const {
+    auto it = m_driverPositions.find(role);
+    if (it != m_driverPositions.end()) {
+        return it->second;
+    }
+    return {0.5 * m_baffleWidth, 0.5 * m_baffleHeight};
+}
+void AbstractEnclosure::setBaffle(double width, double height) {
+    m_baffleWidth = width;
+    m_baffleHeight = height;
+}
+void AbstractEnclosure::setDriverPosition(SiVAL::DriverRole role, double x, double y) {
+    m_driverPositions[role] = {x, y};
+}
 void AbstractEnclosure::setVolume(double vol) {
     m_volume = vol;
 }
@@ -51,11 +71,36 @@ double AbstractEnclosure::volume() {
 
 //// begin protected member methods
 AbstractEnclosure::AbstractEnclosure(SiVAL::EnclosureType type)
-    : m_type(type) {
+    : m_type(type), m_volume(0.0), m_baffleWidth(0.0), m_baffleHeight(0.0) {
 }
-AbstractEnclosure::AbstractEnclosure(const std::string &json) {
+AbstractEnclosure::AbstractEnclosure(const std::string &json)
+    : m_volume(0.0), m_baffleWidth(0.0), m_baffleHeight(0.0) {
 
 }
+nlohmann::json AbstractEnclosure::baffleToJson() const {
+    nlohmann::json drivers = nlohmann::json::array();
+    for (const auto &[role, position] : m_driverPositions) {
+        drivers.push_back({{"role", static_cast<int>(role)}, {"x", position.x}, {"y", position.y}});
+    }
+    return {{"width", m_baffleWidth}, {"height", m_baffleHeight}, {"drivers", drivers}};
+}
+void AbstractEnclosure::readJson(const std::string &json) {
+    const nlohmann::json data = nlohmann::json::parse(json);
+    m_volume = data.value("volume", m_volume);
+    if (!data.contains("baffle")) {
+        return;
+    }
+    const nlohmann::json &baffle = data.at("baffle");
+    m_baffleWidth = baffle.value("width", m_baffleWidth);
+    m_baffleHeight = baffle.value("height", m_baffleHeight);
+    if (baffle.contains("drivers")) {
+        m_driverPositions.clear();
+        for (const nlohmann::json &driver : baffle.at("drivers")) {
+            m_driverPositions[static_cast<SiVAL::DriverRole>(driver.at("role").get<int>())] =
+                {driver.at("x").get<double>(), driver.at("y").get<double>()};
+        }
+    }
+}
 //// end protected member methods
 
 //// begin protected member methods (internal use only)
@@ -49,6 +49,9 @@ void SiVAL::AbstractResponse::setDriver(std::shared_ptr<const SiVAL::AbstractDri
 void SiVAL::AbstractResponse::setEnclosure(AbstractEnclosure &enclosure) {
     m_enclosure = enclosure;
 }
+SiVAL::ResponseType SiVAL::AbstractResponse::type() {
+    return m_type;
+}
 
 //// end public member methods
 
@@ -51,6 +51,11 @@ bool AcousticSetup::addDriver(SiVAL::DriverRole role, const std::string &json, i
     std::pair result = m_drivers.emplace(role, std::move(rc));
     return result.second;
 }
+bool AcousticSetup::addDriver(SiVAL::DriverRole role, std::shared_ptr<const SiVAL::AbstractDriver> driver, int count) {
+    std::unique_ptr<RoleConfig> rc = std::make_unique<RoleConfig>(std::move(driver), count);
+    std::pair result = m_drivers.emplace(role, std::move(rc));
+    return result.second;
+}
 /**
 *  @todo implement enclosure and environment into response
 */
@@ -95,11 +100,22 @@ AbstractResponse* SiVAL::AcousticSetup::responseByType(SiVAL::ResponseType type)
 
     return nullptr; // Not found
 }
+std::vector<SiVAL::DriverRole> SiVAL::AcousticSetup::roles() const {
+    std::vector<SiVAL::DriverRole> result;
+    result.reserve(m_drivers.size());
+    for (const auto &[role, config] : m_drivers) {
+        result.push_back(role);
+    }
+    return result;
+}
 
 void AcousticSetup::setDriver(SiVAL::DriverRole role, const std::string &json, int count) {
     std::unique_ptr<RoleConfig> rc = std::make_unique<RoleConfig>(SiVAL::Driver::Factory::create(role, json), count);
     m_drivers[role] = std::move(rc);
 }
+void AcousticSetup::setDriver(SiVAL::DriverRole role, std::shared_ptr<const SiVAL::AbstractDriver> driver, int count) {
+    m_drivers[role] = std::make_unique<RoleConfig>(std::move(driver), count);
+}
 void AcousticSetup::setResponse(SiVAL::ResponseType type, std::unique_ptr<AbstractResponse> response) {
     m_responses[type] = std::move(response);
 }
@@ -0,0 +1,200 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <list>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/components/driver/cache.hpp"
+#include <sival/components/driver/factory.hpp>
+#include <sival/core/exceptions.hpp>
+#include <sival/utils/parallel.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+//// end static definitions
+
+namespace SiVAL {
+namespace Driver {
+//// begin static functions
+//// end static functions
+
+/**
+ * @brief One independently locked part of the cache.
+ * @details The list holds the entries from the most to the least recently used,
+ * the map finds the entry of an identifier in it.
+ */
+struct Cache::Shard {
+    struct Entry {
+        std::string identifier;
+        std::shared_future<std::shared_ptr<const SiVAL::AbstractDriver>> driver;
+        std::uint64_t ticket;           ///< Tells a reloaded entry from the one that failed.
+    };
+    struct Hash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view text) const {
+            return std::hash<std::string_view>()(text);
+        }
+    };
+
+    void erase(std::list<Entry>::iterator entry) {
+        map.erase(entry->identifier);
+        entries.erase(entry);
+    }
+
+    mutable std::mutex mutex;
+    std::list<Entry> entries;
+    std::unordered_map<std::string_view, std::list<Entry>::iterator, Hash, std::equal_to<>> map;
+};
+
+//// begin public member methods
+Cache::Cache(SiVAL::AbstractDriverResolver &resolver)
+    : Cache(resolver, Settings()) {
+}
+Cache::Cache(SiVAL::AbstractDriverResolver &resolver, const Settings &settings)
+    : m_resolver(resolver),
+    m_shardCapacity(0),
+    m_shardCount(settings.shards),
+    m_loads(0),
+    m_tickets(0) {
+    if (settings.capacity == 0 || settings.shards == 0) {
+        throw SiVAL::Exceptions::OutOfRange("Driver cache needs a capacity and at least one shard.");
+    }
+    m_shardCapacity = (settings.capacity + settings.shards - 1) / settings.shards;
+    m_shards = std::make_unique<Shard[]>(m_shardCount);
+}
+Cache::~Cache() {
+    std::lock_guard<std::mutex> lock(m_prefetchMutex);
+    for (const std::shared_future<std::size_t> &prefetch : m_prefetches) {
+        prefetch.wait();
+    }
+}
+void Cache::clear() {
+    for (std::size_t s = 0; s < m_shardCount; ++s) {
+        std::lock_guard<std::mutex> lock(m_shards[s].mutex);
+        m_shards[s].map.clear();
+        m_shards[s].entries.clear();
+    }
+}
+bool Cache::contains(const std::string &identifier) const {
+    const Shard &part = shard(identifier);
+    std::lock_guard<std::mutex> lock(part.mutex);
+    return part.map.find(identifier) != part.map.end();
+}
+std::shared_ptr<const SiVAL::AbstractDriver> Cache::get(const std::string &identifier) {
+    Shard &part = shard(identifier);
+    std::promise<std::shared_ptr<const SiVAL::AbstractDriver>> promise;
+    std::shared_future<std::shared_ptr<const SiVAL::AbstractDriver>> driver;
+    std::uint64_t ticket = 0;
+    {
+        std::lock_guard<std::mutex> lock(part.mutex);
+        const auto found = part.map.find(identifier);
+        if (found != part.map.end()) {
+            part.entries.splice(part.entries.begin(), part.entries, found->second);
+            driver = found->second->driver;
+        } else {
+            // Eintrag sofort anlegen, damit weitere Anfragen auf dieses Laden warten
+            driver = promise.get_future().share();
+            ticket = ++m_tickets;
+            part.entries.push_front({identifier, driver, ticket});
+            part.map.emplace(part.entries.front().identifier, part.entries.begin());
+            while (part.entries.size() > m_shardCapacity) {
+                part.erase(std::prev(part.entries.end()));
+            }
+        }
+    }
+    if (ticket != 0) {
+        try {
+            promise.set_value(load(identifier));
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+            std::lock_guard<std::mutex> lock(part.mutex);
+            const auto found = part.map.find(identifier);
+            if (found != part.map.end() && found->second->ticket == ticket) {
+                part.erase(found->second);
+            }
+        }
+    }
+    return driver.get();
+}
+std::size_t Cache::loads() const {
+    return m_loads.load();
+}
+std::shared_future<std::size_t> Cache::prefetch(std::vector<std::string> identifiers, std::size_t threads) {
+    std::shared_future<std::size_t> done = std::async(std::launch::async,
+        [this, identifiers = std::move(identifiers), threads]() {
+            std::atomic<std::size_t> available(0);
+            SiVAL::Utils::parallelFor(identifiers.size(), [&](std::size_t index, std::size_t) {
+                try {
+                    get(identifiers[index]);
+                    ++available;
+                } catch (const std::exception&) {
+                    // Der Fehler wird beim nächsten get() erneut gemeldet
+                }
+            }, threads);
+            return available.load();
+        }).share();
+
+    std::lock_guard<std::mutex> lock(m_prefetchMutex);
+    std::erase_if(m_prefetches, [](const std::shared_future<std::size_t> &prefetch) {
+        return prefetch.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+    });
+    m_prefetches.push_back(done);
+    return done;
+}
+std::size_t Cache::size() const {
+    std::size_t count = 0;
+    for (std::size_t s = 0; s < m_shardCount; ++s) {
+        std::lock_guard<std::mutex> lock(m_shards[s].mutex);
+        count += m_shards[s].entries.size();
+    }
+    return count;
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+std::shared_ptr<const SiVAL::AbstractDriver> Cache::load(const std::string &identifier) {
+    const std::string json = m_resolver.resolve(identifier);
+    std::shared_ptr<const SiVAL::AbstractDriver> driver = Factory::create(json.data(), json.data() + json.size());
+    ++m_loads;
+    return driver;
+}
+Cache::Shard& Cache::shard(const std::string &identifier) const {
+    return m_shards[std::hash<std::string_view>()(identifier) % m_shardCount];
+}
+//// end private member methods
+}
+}
@@ -0,0 +1,198 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/components/driver/catalog.hpp"
+#include <sival/components/driver/factory.hpp>
+#include <sival/core/exceptions.hpp>
+#include <sival/utils/mappedfile.hpp>
+#include <sival/utils/parallel.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+//// end static definitions
+
+namespace SiVAL {
+namespace Driver {
+//// begin static functions
+/**
+ * @brief Reads a whole file into `buffer`, reusing its capacity.
+ * @throws SiVAL::Exceptions::FileAccessError If the file cannot be read.
+ */
+static void readFile(const std::string &path, std::string &buffer) {
+    std::FILE* file = std::fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        throw SiVAL::Exceptions::FileAccessError("Cannot open driver file: " + path);
+    }
+    long size = -1;
+    if (std::fseek(file, 0, SEEK_END) == 0) {
+        size = std::ftell(file);
+    }
+    if (size < 0 || std::fseek(file, 0, SEEK_SET) != 0) {
+        std::fclose(file);
+        throw SiVAL::Exceptions::FileAccessError("Cannot read driver file: " + path);
+    }
+    buffer.resize(static_cast<std::size_t>(size));
+    const std::size_t read = size > 0 ? std::fread(buffer.data(), 1, buffer.size(), file) : 0;
+    std::fclose(file);
+    if (read != buffer.size()) {
+        throw SiVAL::Exceptions::FileAccessError("Cannot read driver file: " + path);
+    }
+}
+/**
+ * @brief Parses one document and creates its driver.
+ * @param message Receives the error, the driver is `nullptr` then.
+ */
+static std::shared_ptr<SiVAL::AbstractDriver> create(const char* begin, const char* end, std::string &message) {
+    try {
+        return Factory::create(begin, end);
+    } catch (const std::exception &e) {
+        message = e.what();
+    }
+    return nullptr;
+}
+//// end static functions
+
+//// begin public member methods
+Catalog::Catalog() {
+}
+Catalog::~Catalog() {
+}
+bool Catalog::empty() const {
+    return m_entries.empty();
+}
+const std::vector<Catalog::Entry>& Catalog::entries() const {
+    return m_entries;
+}
+const std::vector<Catalog::Error>& Catalog::errors() const {
+    return m_errors;
+}
+Catalog Catalog::loadDirectory(const std::string &path, std::size_t threads) {
+    std::vector<std::string> paths;
+    try {
+        for (const auto &entry : std::filesystem::recursive_directory_iterator(path)) {
+            if (entry.is_regular_file() && entry.path().extension() == ".json") {
+                paths.push_back(entry.path().string());
+            }
+        }
+    } catch (const std::filesystem::filesystem_error &e) {
+        throw SiVAL::Exceptions::FileAccessError("Cannot read driver directory: " + path + " (" + e.what() + ")");
+    }
+    std::sort(paths.begin(), paths.end());
+    return loadFiles(paths, threads);
+}
+Catalog Catalog::loadFiles(const std::vector<std::string> &paths, std::size_t threads) {
+    const std::size_t count = paths.size();
+    std::vector<std::shared_ptr<SiVAL::AbstractDriver>> drivers(count);
+    std::vector<std::string> messages(count);
+    // Ein Lesepuffer je Thread, er wächst auf die größte Datei und wird wiederverwendet
+    std::vector<std::string> buffers(SiVAL::Utils::threadCount(threads, count));
+
+    SiVAL::Utils::parallelFor(count, [&](std::size_t index, std::size_t worker) {
+        std::string &buffer = buffers[worker];
+        try {
+            readFile(paths[index], buffer);
+        } catch (const SiVAL::Exceptions::FileAccessError &e) {
+            messages[index] = e.errorMsg();
+            return;
+        }
+        drivers[index] = create(buffer.data(), buffer.data() + buffer.size(), messages[index]);
+    }, threads);
+
+    Catalog catalog;
+    catalog.m_entries.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (drivers[i]) {
+            catalog.m_entries.push_back({std::move(drivers[i]), paths[i], 0});
+        } else {
+            catalog.m_errors.push_back({paths[i], 0, std::move(messages[i])});
+        }
+    }
+    return catalog;
+}
+Catalog Catalog::loadJsonl(const std::string &path, std::size_t threads) {
+    const SiVAL::Utils::MappedFile file(path);
+
+    // Zeilen einmal sequentiell abgrenzen, geparst wird parallel direkt aus der Abbildung
+    struct Line {
+        const char* begin;
+        const char* end;
+        std::size_t number;
+    };
+    std::vector<Line> lines;
+    const char* p = file.begin();
+    const char* const end = file.end();
+    for (std::size_t number = 1; p < end; ++number) {
+        const void* found = std::memchr(p, '\n', static_cast<std::size_t>(end - p));
+        const char* next = found != nullptr ? static_cast<const char*>(found) : end;
+        const char* last = next;
+        while (last > p && (last[-1] == '\r' || last[-1] == ' ' || last[-1] == '\t')) {
+            --last;
+        }
+        if (last > p) {
+            lines.push_back({p, last, number});
+        }
+        p = next == end ? end : next + 1;
+    }
+
+    const std::size_t count = lines.size();
+    std::vector<std::shared_ptr<SiVAL::AbstractDriver>> drivers(count);
+    std::vector<std::string> messages(count);
+    SiVAL::Utils::parallelFor(count, [&](std::size_t index, std::size_t) {
+        drivers[index] = create(lines[index].begin, lines[index].end, messages[index]);
+    }, threads);
+
+    Catalog catalog;
+    catalog.m_entries.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        if (drivers[i]) {
+            catalog.m_entries.push_back({std::move(drivers[i]), path, lines[i].number});
+        } else {
+            catalog.m_errors.push_back({path, lines[i].number, std::move(messages[i])});
+        }
+    }
+    return catalog;
+}
+std::size_t Catalog::size() const {
+    return m_entries.size();
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+//// end private member methods
+}
+}
@@ -0,0 +1,421 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/components/driver/database.hpp"
+#include <sival/components/driver/catalog.hpp>
+#include <sival/core/exceptions.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+/// Magic number at the start of the file.
+static constexpr char kMagic[8] = {'S', 'I', 'V', 'A', 'L', 'D', 'B', '\0'};
+/// Byte order marker, read back as another value on a machine of the other byte order.
+static constexpr std::uint32_t kByteOrder = 0x01020304;
+
+static_assert(std::is_trivially_copyable_v<SiVAL::Driver::Database::Record> &&
+              std::is_standard_layout_v<SiVAL::Driver::Database::Record>,
+              "Database::Record is read directly from the file");
+static_assert(sizeof(SiVAL::Driver::Database::Header) == 64, "Database::Header must stay 64 bytes");
+static_assert(sizeof(SiVAL::Driver::Database::Record) % alignof(double) == 0,
+              "Database::Record must keep the doubles aligned");
+//// end static definitions
+
+namespace SiVAL {
+namespace Driver {
+//// begin static functions
+static double fromOptional(const std::optional<double> &value) {
+    return value.has_value() ? value.value() : std::numeric_limits<double>::quiet_NaN();
+}
+static std::optional<double> toOptional(double value) {
+    if (std::isnan(value)) {
+        return std::nullopt;
+    }
+    return value;
+}
+/**
+ * @brief Collects the strings of all records, every distinct string once.
+ */
+class StringPool
+{
+public:
+    Database::Text add(const std::string &text) {
+        const auto found = m_offsets.find(text);
+        if (found != m_offsets.end()) {
+            return {found->second, static_cast<std::uint32_t>(text.size())};
+        }
+        if (m_bytes.size() + text.size() > std::numeric_limits<std::uint32_t>::max()) {
+            throw SiVAL::Exceptions::OutOfRange("The string pool of the driver database exceeds 4 GiB.");
+        }
+        const auto offset = static_cast<std::uint32_t>(m_bytes.size());
+        m_bytes += text;
+        m_offsets.emplace(text, offset);
+        return {offset, static_cast<std::uint32_t>(text.size())};
+    }
+    const std::string& bytes() const {
+        return m_bytes;
+    }
+
+private:
+    std::string m_bytes;
+    std::unordered_map<std::string, std::uint32_t> m_offsets;
+};
+//// end static functions
+
+//// begin public member methods
+Database::View::View(const Record* record, const char* strings)
+    : m_record(record),
+    m_strings(strings) {
+}
+const Database::Record& Database::View::record() const {
+    return *m_record;
+}
+std::string_view Database::View::uuid() const {
+    return text(m_record->uuid);
+}
+std::string_view Database::View::brand() const {
+    return text(m_record->brand);
+}
+std::string_view Database::View::manufacturer() const {
+    return text(m_record->manufacturer);
+}
+std::string_view Database::View::providedBy() const {
+    return text(m_record->providedBy);
+}
+std::string_view Database::View::comment() const {
+    return text(m_record->comment);
+}
+std::string_view Database::View::model() const {
+    return text(m_record->model);
+}
+bool Database::View::indexed() const {
+    return m_record->indexed != 0;
+}
+std::string_view Database::View::speakerType() const {
+    return text(m_record->speakerType);
+}
+double Database::View::impedance() const {
+    return m_record->impedance;
+}
+double Database::View::sensitivity() const {
+    return m_record->sensitivity;
+}
+double Database::View::re() const {
+    return m_record->re;
+}
+double Database::View::le() const {
+    return m_record->le;
+}
+SiVAL::VoiceCoil Database::View::voiceCoil() const {
+    SiVAL::VoiceCoil coil;
+    coil.model = static_cast<SiVAL::VoiceCoil::Model>(m_record->coilModel);
+    coil.le = m_record->le;
+    coil.r2 = m_record->coil[0];
+    coil.l2 = m_record->coil[1];
+    coil.krm = m_record->coil[2];
+    coil.erm = m_record->coil[3];
+    coil.kxm = m_record->coil[4];
+    coil.exm = m_record->coil[5];
+    coil.k = m_record->coil[6];
+    coil.n = m_record->coil[7];
+    return coil;
+}
+double Database::View::znom() const {
+    return m_record->znom;
+}
+double Database::View::pe() const {
+    return m_record->pe;
+}
+double Database::View::pmax() const {
+    return m_record->pmax;
+}
+double Database::View::bl() const {
+    return m_record->bl;
+}
+double Database::View::motorConstant() const {
+    return m_record->motorConstant;
+}
+double Database::View::fluxDensity() const {
+    return m_record->fluxDensity;
+}
+double Database::View::fs() const {
+    return m_record->fs;
+}
+double Database::View::qms() const {
+    return m_record->qms;
+}
+double Database::View::qes() const {
+    return m_record->qes;
+}
+double Database::View::qts() const {
+    return m_record->qts;
+}
+double Database::View::mms() const {
+    return m_record->mms;
+}
+double Database::View::mmd() const {
+    return m_record->mmd;
+}
+double Database::View::stiffness() const {
+    return m_record->stiffness;
+}
+double Database::View::cms() const {
+    return m_record->cms;
+}
+double Database::View::vas() const {
+    return m_record->vas;
+}
+double Database::View::rms() const {
+    return m_record->rms;
+}
+double Database::View::sd() const {
+    return m_record->sd;
+}
+std::optional<double> Database::View::xmax() const {
+    return toOptional(m_record->xmax);
+}
+std::optional<double> Database::View::xlim() const {
+    return toOptional(m_record->xlim);
+}
+std::optional<double> Database::View::vd() const {
+    return toOptional(m_record->vd);
+}
+std::string_view Database::View::nominalDiameter() const {
+    return text(m_record->nominalDiameter);
+}
+double Database::View::vcDiameter() const {
+    return m_record->vcDiameter;
+}
+double Database::View::windingHeight() const {
+    return m_record->windingHeight;
+}
+double Database::View::airGapHeight() const {
+    return m_record->airGapHeight;
+}
+double Database::View::effectiveDiameter() const {
+    return m_record->effectiveDiameter;
+}
+double Database::View::baffleCutoutDiameter() const {
+    return m_record->baffleCutoutDiameter;
+}
+double Database::View::volumeOccupied() const {
+    return m_record->volumeOccupied;
+}
+double Database::View::netWeight() const {
+    return m_record->netWeight;
+}
+std::string_view Database::View::material() const {
+    return text(m_record->material);
+}
+std::string_view Database::View::text(const Text &text) const {
+    return std::string_view(m_strings + text.offset, text.length);
+}
+
+Database::Database(const std::string &path)
+    : m_file(path) {
+    auto fail = [&](const std::string &reason) {
+        throw SiVAL::Exceptions::FileAccessError("Invalid driver database " + path + ": " + reason);
+    };
+    if (m_file.size() < sizeof(Header)) {
+        fail("too small");
+    }
+    Header header;
+    std::memcpy(&header, m_file.data(), sizeof(Header));
+    if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) {
+        fail("no driver database");
+    }
+    if (header.byteOrder != kByteOrder) {
+        fail("written with another byte order");
+    }
+    if (header.version != kVersion) {
+        fail("version " + std::to_string(header.version) + ", expected " + std::to_string(kVersion));
+    }
+    if (header.recordSize != sizeof(Record)) {
+        fail("unexpected record size");
+    }
+    const std::uint64_t size = m_file.size();
+    if (header.records % alignof(Record) != 0 || header.records > size ||
+        header.count > (size - header.records) / sizeof(Record) || header.strings > size ||
+        header.stringsSize > size - header.strings) {
+        fail("truncated");
+    }
+    m_records = reinterpret_cast<const Record*>(m_file.data() + header.records);
+    m_strings = m_file.data() + header.strings;
+    m_count = static_cast<std::size_t>(header.count);
+
+    // Alle Verweise in den String-Pool einmal prüfen, die Views greifen danach ungeprüft zu
+    for (std::size_t i = 0; i < m_count; ++i) {
+        const Record &record = m_records[i];
+        for (const Text &text : {record.uuid, record.brand, record.manufacturer, record.providedBy, record.comment,
+                                 record.model, record.speakerType, record.nominalDiameter, record.material}) {
+            if (text.offset > header.stringsSize || text.length > header.stringsSize - text.offset) {
+                fail("string out of range in record " + std::to_string(i));
+            }
+        }
+        if (record.coilModel > static_cast<std::uint32_t>(SiVAL::VoiceCoil::Model::Leach)) {
+            fail("unknown voice coil model in record " + std::to_string(i));
+        }
+    }
+}
+Database::Database(Database &&other) noexcept
+    : m_file(std::move(other.m_file)),
+    m_records(std::exchange(other.m_records, nullptr)),
+    m_strings(std::exchange(other.m_strings, nullptr)),
+    m_count(std::exchange(other.m_count, 0)) {
+}
+Database& Database::operator=(Database &&other) noexcept {
+    if (this != &other) {
+        m_file = std::move(other.m_file);
+        m_records = std::exchange(other.m_records, nullptr);
+        m_strings = std::exchange(other.m_strings, nullptr);
+        m_count = std::exchange(other.m_count, 0);
+    }
+    return *this;
+}
+Database::~Database() {
+}
+Database::View Database::at(std::size_t index) const {
+    if (index >= m_count) {
+        throw SiVAL::Exceptions::OutOfRange("Driver index " + std::to_string(index) + " out of range.");
+    }
+    return View(m_records + index, m_strings);
+}
+const Database::Record* Database::records() const {
+    return m_records;
+}
+std::size_t Database::size() const {
+    return m_count;
+}
+void Database::write(const std::string &path, const Catalog &catalog) {
+    std::vector<std::shared_ptr<SiVAL::AbstractDriver>> drivers;
+    drivers.reserve(catalog.size());
+    for (const Catalog::Entry &entry : catalog.entries()) {
+        drivers.push_back(entry.driver);
+    }
+    write(path, drivers);
+}
+void Database::write(const std::string &path, const std::vector<std::shared_ptr<SiVAL::AbstractDriver>> &drivers) {
+    StringPool pool;
+    std::vector<Record> records(drivers.size());
+    for (std::size_t i = 0; i < drivers.size(); ++i) {
+        const SiVAL::AbstractDriver &d = *drivers[i];
+        Record &r = records[i];
+        std::memset(&r, 0, sizeof(Record));
+        r.impedance = d.impedance();
+        r.sensitivity = d.sensitivity();
+        r.re = d.re();
+        r.le = d.le();
+        r.znom = d.znom();
+        r.pe = d.pe();
+        r.pmax = d.pmax();
+        r.bl = d.bl();
+        r.motorConstant = d.motorConstant();
+        r.fluxDensity = d.fluxDensity();
+        r.fs = d.fs();
+        r.qms = d.qms();
+        r.qes = d.qes();
+        r.qts = d.qts();
+        r.mms = d.mms();
+        r.mmd = d.mmd();
+        r.stiffness = d.stiffness();
+        r.cms = d.cms();
+        r.vas = d.vas();
+        r.rms = d.rms();
+        r.sd = d.sd();
+        r.xmax = fromOptional(d.xmax());
+        r.xlim = fromOptional(d.xlim());
+        r.vd = fromOptional(d.vd());
+        r.vcDiameter = d.vcDiameter();
+        r.windingHeight = d.windingHeight();
+        r.airGapHeight = d.airGapHeight();
+        r.effectiveDiameter = d.effectiveDiameter();
+        r.baffleCutoutDiameter = d.baffleCutoutDiameter();
+        r.volumeOccupied = d.volumeOccupied();
+        r.netWeight = d.netWeight();
+        const SiVAL::VoiceCoil &coil = d.voiceCoil();
+        r.coilModel = static_cast<std::uint32_t>(coil.model);
+        r.coil[0] = coil.r2;
+        r.coil[1] = coil.l2;
+        r.coil[2] = coil.krm;
+        r.coil[3] = coil.erm;
+        r.coil[4] = coil.kxm;
+        r.coil[5] = coil.exm;
+        r.coil[6] = coil.k;
+        r.coil[7] = coil.n;
+        r.uuid = pool.add(d.uuid());
+        r.brand = pool.add(d.brand());
+        r.manufacturer = pool.add(d.manufacturer());
+        r.providedBy = pool.add(d.providedBy());
+        r.comment = pool.add(d.comment());
+        r.model = pool.add(d.model());
+        r.speakerType = pool.add(d.speakerType());
+        r.nominalDiameter = pool.add(d.nominalDiameter());
+        r.material = pool.add(d.material());
+        r.indexed = d.indexed() ? 1 : 0;
+    }
+
+    Header header;
+    std::memset(&header, 0, sizeof(Header));
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.recordSize = sizeof(Record);
+    header.count = records.size();
+    header.records = sizeof(Header);
+    header.strings = header.records + records.size() * sizeof(Record);
+    header.stringsSize = pool.bytes().size();
+    header.byteOrder = kByteOrder;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw SiVAL::Exceptions::FileAccessError("Cannot create driver database: " + path);
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    file.write(reinterpret_cast<const char*>(records.data()), static_cast<std::streamsize>(records.size() * sizeof(Record)));
+    file.write(pool.bytes().data(), static_cast<std::streamsize>(pool.bytes().size()));
+    file.close();
+    if (!file) {
+        throw SiVAL::Exceptions::FileAccessError("Cannot write driver database: " + path);
+    }
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+//// end private member methods
+}
+}
@@ -18,6 +18,7 @@
 //// begin project specific includes
 #include <sival/core/exceptions.hpp>
 #include "sival/components/driver/factory.hpp"
+#include "sival/components/driver/lowdriver.hpp"
 //// end project specific includes
 
 //// begin using namespaces
@@ -90,7 +91,14 @@ std::shared_ptr<AbstractDriver> Factory::create(DriverRole expectedRole, const s
     // This case is reached if the type is valid but not yet implemented in the factory
     // throw DriverCreationException("Driver type '" + actualType + "' is not supported by the factory yet.");
 
-    return nullptr;
+    return create(jsonFilePath.data(), jsonFilePath.data() + jsonFilePath.size());
+}
+std::shared_ptr<AbstractDriver> Factory::create(nlohmann::json &data) {
+    // Bis die spezialisierten Treiber existieren, wird jeder Treiber als LowDriver angelegt.
+    return std::make_shared<LowDriver>(data);
+}
+std::shared_ptr<AbstractDriver> Factory::create(const char* begin, const char* end) {
+    return std::make_shared<LowDriver>(begin, end);
 }
 
 //// end public member methods
@@ -0,0 +1,94 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <filesystem>
+#include <system_error>
+#include <utility>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/components/driver/fileresolver.hpp"
+#include <sival/core/exceptions.hpp>
+#include <sival/utils/mappedfile.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+//// end static definitions
+
+namespace SiVAL {
+namespace Driver {
+//// begin static functions
+static bool isFile(const std::filesystem::path &path) {
+    std::error_code error;
+    return std::filesystem::is_regular_file(path, error);
+}
+//// end static functions
+
+//// begin public member methods
+FileResolver::FileResolver() {
+}
+FileResolver::FileResolver(std::vector<std::string> directories)
+    : m_directories(std::move(directories)) {
+}
+FileResolver::~FileResolver() {
+}
+const std::vector<std::string>& FileResolver::directories() const {
+    return m_directories;
+}
+std::string FileResolver::locate(const std::string &identifier) const {
+    if (identifier.empty()) {
+        throw SiVAL::Exceptions::FileAccessError("Cannot resolve an empty driver identifier.");
+    }
+    if (isFile(identifier)) {
+        return identifier;
+    }
+    for (const std::string &directory : m_directories) {
+        const std::filesystem::path base = std::filesystem::path(directory) / identifier;
+        std::filesystem::path candidate = base;
+        candidate += ".json";
+        if (isFile(candidate)) {
+            return candidate.string();
+        }
+        if (isFile(base)) {
+            return base.string();
+        }
+    }
+    throw SiVAL::Exceptions::FileAccessError("Cannot resolve driver: " + identifier);
+}
+std::string FileResolver::resolve(const std::string &identifier) {
+    const SiVAL::Utils::MappedFile file(locate(identifier));
+    return std::string(file.begin(), file.end());
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+//// end private member methods
+}
+}
@@ -0,0 +1,349 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <utility>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/components/driver/index.hpp"
+#include <sival/components/driver/database.hpp>
+#include <sival/core/exceptions.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+/// Below this share of candidates (1 / kScanRatio) the candidates of the most selective range are checked one by one.
+static constexpr std::size_t kScanRatio = 2;
+//// end static definitions
+
+namespace SiVAL {
+namespace Driver {
+//// begin static functions
+/**
+ * @brief Appends the positions of all set bytes of `mask` in ascending order.
+ * @details Eight bytes are tested at once, so long runs without hits cost little.
+ */
+static void collect(const std::vector<std::uint8_t> &mask, std::vector<std::size_t> &result, std::size_t expected) {
+    result.reserve(expected);
+    const std::uint8_t* m = mask.data();
+    const std::size_t count = mask.size();
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        std::uint64_t word;
+        std::memcpy(&word, m + i, sizeof(word));
+        if (word == 0) {
+            continue;
+        }
+        for (std::size_t k = 0; k < 8; ++k) {
+            if (m[i + k] != 0) {
+                result.push_back(i + k);
+            }
+        }
+    }
+    for (; i < count; ++i) {
+        if (m[i] != 0) {
+            result.push_back(i);
+        }
+    }
+}
+//// end static functions
+
+//// begin public member methods
+Index::Index() {
+}
+Index::Index(const std::vector<std::shared_ptr<SiVAL::AbstractDriver>> &drivers)
+    : m_table(drivers),
+    m_names(drivers.size()),
+    m_erased(drivers.size(), 0) {
+    for (std::size_t i = 0; i < drivers.size(); ++i) {
+        add(*drivers[i], i);
+    }
+    build();
+}
+Index::Index(const Database &database)
+    : m_table(database),
+    m_names(database.size()),
+    m_erased(database.size(), 0) {
+    for (std::size_t i = 0; i < database.size(); ++i) {
+        add(database.at(i), i);
+    }
+    build();
+}
+Index::~Index() {
+}
+std::vector<std::size_t> Index::brand(std::string_view name) const {
+    return lookup(m_brands, name);
+}
+void Index::erase(std::size_t position) {
+    if (erased(position)) {
+        return;
+    }
+    sortOut(position);
+    unlink(position);
+    m_table.erase(position);
+    m_erased[position] = 1;
+}
+bool Index::erased(std::size_t position) const {
+    if (position >= m_table.size()) {
+        throw SiVAL::Exceptions::OutOfRange("Driver position out of range in index.");
+    }
+    return m_erased[position] != 0;
+}
+std::vector<std::size_t> Index::find(const std::vector<Range> &ranges) const {
+    for (const Range &range : ranges) {
+        if (static_cast<std::size_t>(range.parameter) >= kParameters) {
+            throw SiVAL::Exceptions::OutOfRange("Unknown driver parameter in index query.");
+        }
+    }
+    const std::size_t count = m_table.size();
+    std::vector<std::size_t> result;
+    if (ranges.empty()) {
+        result.reserve(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            if (m_erased[i] == 0) {
+                result.push_back(i);
+            }
+        }
+        return result;
+    }
+
+    // --- Kandidaten je Bereich per binärer Suche zählen ---
+    std::size_t best = 0;
+    std::size_t bestLower = 0;
+    std::size_t bestUpper = 0;
+    std::size_t bestCount = count + 1;
+    for (std::size_t r = 0; r < ranges.size(); ++r) {
+        const Range &range = ranges[r];
+        if (!(range.min <= range.max)) {
+            return result;
+        }
+        const std::vector<double> &sorted = m_sorted[static_cast<std::size_t>(range.parameter)];
+        const std::size_t lower = static_cast<std::size_t>(
+            std::lower_bound(sorted.begin(), sorted.end(), range.min) - sorted.begin());
+        const std::size_t upper = static_cast<std::size_t>(
+            std::upper_bound(sorted.begin(), sorted.end(), range.max) - sorted.begin());
+        if (upper - lower < bestCount) {
+            best = r;
+            bestLower = lower;
+            bestUpper = upper;
+            bestCount = upper - lower;
+        }
+    }
+    if (bestCount == 0) {
+        return result;
+    }
+
+    std::vector<std::uint8_t> mask;
+    if (bestCount * kScanRatio <= count) {
+        // --- Wenige Kandidaten: nur diese gegen die übrigen Spalten prüfen ---
+        mask.assign(count, 0);
+        const std::uint32_t* order = m_order[static_cast<std::size_t>(ranges[best].parameter)].data();
+        for (std::size_t k = bestLower; k < bestUpper; ++k) {
+            const std::size_t position = order[k];
+            bool match = true;
+            for (std::size_t r = 0; r < ranges.size() && match; ++r) {
+                if (r == best) {
+                    continue;
+                }
+                const double v = m_table.column(ranges[r].parameter)[position];
+                match = v >= ranges[r].min && v <= ranges[r].max;
+            }
+            mask[position] = match ? 1 : 0;
+        }
+    } else {
+        // --- Viele Kandidaten: alle Spalten verzweigungsfrei durchlaufen ---
+        mask.assign(count, 1);
+        std::uint8_t* __restrict m = mask.data();
+        for (const Range &range : ranges) {
+            const double* __restrict c = m_table.column(range.parameter).data();
+            const double lower = range.min;
+            const double upper = range.max;
+            for (std::size_t i = 0; i < count; ++i) {
+                m[i] &= static_cast<std::uint8_t>((c[i] >= lower) & (c[i] <= upper));
+            }
+        }
+    }
+    collect(mask, result, bestCount);
+    return result;
+}
+std::size_t Index::insert(const SiVAL::AbstractDriver &driver) {
+    if (m_table.size() >= std::numeric_limits<std::uint32_t>::max()) {
+        throw SiVAL::Exceptions::OutOfRange("Too many drivers for the index.");
+    }
+    const std::size_t position = m_table.append(driver);
+    m_names.emplace_back();
+    m_erased.push_back(0);
+    add(driver, position);
+    sortIn(position);
+    return position;
+}
+std::vector<std::size_t> Index::model(std::string_view name) const {
+    return lookup(m_models, name);
+}
+void Index::replace(std::size_t position, const SiVAL::AbstractDriver &driver) {
+    if (!erased(position)) {
+        sortOut(position);
+        unlink(position);
+    }
+    m_table.replace(position, driver);
+    m_erased[position] = 0;
+    add(driver, position);
+    sortIn(position);
+}
+std::size_t Index::size() const {
+    return m_table.size();
+}
+const Table& Index::table() const {
+    return m_table;
+}
+std::optional<std::size_t> Index::uuid(std::string_view id) const {
+    const auto found = m_uuids.find(id);
+    if (found == m_uuids.end()) {
+        return std::nullopt;
+    }
+    return found->second.front();
+}
+double Index::value(std::size_t position, Parameter parameter) const {
+    return m_table.value(position, parameter);
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+std::size_t Index::Hash::operator()(std::string_view text) const {
+    return std::hash<std::string_view>()(text);
+}
+template<class Source>
+void Index::add(const Source &driver, std::size_t position) {
+    // AbstractDriver und Database::View haben dieselben Zugriffsmethoden
+    link(position, {std::string(driver.uuid()), std::string(driver.brand()), std::string(driver.model())});
+}
+void Index::build() {
+    const std::size_t count = m_table.size();
+    if (count > std::numeric_limits<std::uint32_t>::max()) {
+        throw SiVAL::Exceptions::OutOfRange("Too many drivers for the index.");
+    }
+    std::vector<std::pair<double, std::uint32_t>> pairs;
+    pairs.reserve(count);
+    for (std::size_t p = 0; p < kParameters; ++p) {
+        pairs.clear();
+        const Table::Column &column = m_table.column(static_cast<Parameter>(p));
+        for (std::size_t i = 0; i < count; ++i) {
+            // Unbekannte Werte (NaN) kommen nicht in die sortierte Kopie
+            if (column[i] == column[i]) {
+                pairs.emplace_back(column[i], static_cast<std::uint32_t>(i));
+            }
+        }
+        std::sort(pairs.begin(), pairs.end());
+        m_sorted[p].resize(pairs.size());
+        m_order[p].resize(pairs.size());
+        for (std::size_t k = 0; k < pairs.size(); ++k) {
+            m_sorted[p][k] = pairs[k].first;
+            m_order[p][k] = pairs[k].second;
+        }
+    }
+}
+void Index::link(std::size_t position, Names names) {
+    Positions* maps[3] = {&m_uuids, &m_brands, &m_models};
+    for (std::size_t k = 0; k < 3; ++k) {
+        std::vector<std::size_t> &positions = (*maps[k])[names[k]];
+        // Beim Aufbau wird nur hinten angefügt, sonst sortiert eingefügt
+        if (positions.empty() || positions.back() < position) {
+            positions.push_back(position);
+        } else {
+            positions.insert(std::lower_bound(positions.begin(), positions.end(), position), position);
+        }
+    }
+    m_names[position] = std::move(names);
+}
+std::vector<std::size_t> Index::lookup(const Positions &map, std::string_view name) {
+    const auto found = map.find(name);
+    if (found == map.end()) {
+        return {};
+    }
+    return found->second;
+}
+void Index::sortIn(std::size_t position) {
+    for (std::size_t p = 0; p < kParameters; ++p) {
+        const double v = m_table.column(static_cast<Parameter>(p))[position];
+        if (v != v) {
+            continue;
+        }
+        std::vector<double> &sorted = m_sorted[p];
+        std::vector<std::uint32_t> &order = m_order[p];
+        // Gleiche Werte bleiben wie bei build() nach Position geordnet
+        std::size_t k = static_cast<std::size_t>(std::lower_bound(sorted.begin(), sorted.end(), v) - sorted.begin());
+        while (k < sorted.size() && sorted[k] == v && order[k] < position) {
+            ++k;
+        }
+        sorted.insert(sorted.begin() + static_cast<std::ptrdiff_t>(k), v);
+        order.insert(order.begin() + static_cast<std::ptrdiff_t>(k), static_cast<std::uint32_t>(position));
+    }
+}
+void Index::sortOut(std::size_t position) {
+    for (std::size_t p = 0; p < kParameters; ++p) {
+        const double v = m_table.column(static_cast<Parameter>(p))[position];
+        if (v != v) {
+            continue;
+        }
+        std::vector<double> &sorted = m_sorted[p];
+        std::vector<std::uint32_t> &order = m_order[p];
+        std::size_t k = static_cast<std::size_t>(std::lower_bound(sorted.begin(), sorted.end(), v) - sorted.begin());
+        while (k < sorted.size() && sorted[k] == v && order[k] != position) {
+            ++k;
+        }
+        if (k < sorted.size() && sorted[k] == v) {
+            sorted.erase(sorted.begin() + static_cast<std::ptrdiff_t>(k));
+            order.erase(order.begin() + static_cast<std::ptrdiff_t>(k));
+        }
+    }
+}
+void Index::unlink(std::size_t position) {
+    Positions* maps[3] = {&m_uuids, &m_brands, &m_models};
+    for (std::size_t k = 0; k < 3; ++k) {
+        const auto found = maps[k]->find(m_names[position][k]);
+        if (found == maps[k]->end()) {
+            continue;
+        }
+        std::vector<std::size_t> &positions = found->second;
+        const auto at = std::lower_bound(positions.begin(), positions.end(), position);
+        if (at != positions.end() && *at == position) {
+            positions.erase(at);
+        }
+        if (positions.empty()) {
+            maps[k]->erase(found);
+        }
+    }
+    m_names[position] = Names();
+}
+//// end private member methods
+}
+}
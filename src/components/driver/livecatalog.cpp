@@ -0,0 +1,435 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <exception>
+#include <set>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+//// end system includes
+
+//// begin project specific includes
+#include "sival/components/driver/livecatalog.hpp"
+#include <sival/core/exceptions.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+/// Scan interval of `start()` without inotify.
+static constexpr std::chrono::milliseconds kInterval(1000);
+/// How long the background thread waits at most before it checks whether it should stop.
+static constexpr std::chrono::milliseconds kTick(100);
+/// After the first event, further events are collected until none arrives for this long.
+static constexpr std::chrono::milliseconds kSettle(50);
+/// Batches with more than 1 / kRebuildRatio of the drivers rebuild the index instead of updating it.
+static constexpr std::size_t kRebuildRatio = 64;
+/// The index is compacted once more than 1 / kCompactRatio of its positions are erased.
+static constexpr std::size_t kCompactRatio = 4;
+//// end static definitions
+
+namespace SiVAL {
+namespace Driver {
+//// begin static functions
+static bool isDriverFile(const std::filesystem::path &path) {
+    std::error_code error;
+    return path.extension() == ".json" && std::filesystem::is_regular_file(path, error);
+}
+//// end static functions
+
+/**
+ * @brief Reports the driver files changed below a directory (inotify, Linux only).
+ * @details Every directory of the tree gets a watch. The paths are built the same
+ * way as by `std::filesystem::recursive_directory_iterator`, so they match the keys
+ * of `LiveCatalog::scan()`. New or removed directories and a queue overflow ask for
+ * a full `refresh()`.
+ */
+class LiveCatalog::Notifier
+{
+public:
+    explicit Notifier(const std::string &directory)
+        : m_directory(directory) {
+#if defined(__linux__)
+        m_fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_fd >= 0) {
+            watchTree();
+        }
+#endif
+    }
+    ~Notifier() {
+#if defined(__linux__)
+        if (m_fd >= 0) {
+            close(m_fd);
+        }
+#endif
+    }
+    Notifier(const Notifier&) = delete;
+    Notifier& operator=(const Notifier&) = delete;
+
+    bool valid() const {
+        return m_fd >= 0;
+    }
+
+    /**
+     * @brief Waits up to `timeout` for changes.
+     * @return False if nothing changed.
+     */
+    bool wait(std::chrono::milliseconds timeout, std::set<std::string> &paths, bool &full) {
+#if defined(__linux__)
+        if (!readable(timeout)) {
+            return false;
+        }
+        do {
+            read(paths, full);
+        } while (readable(kSettle));
+        return true;
+#else
+        (void)timeout;
+        (void)paths;
+        (void)full;
+        return false;
+#endif
+    }
+
+    /// Adds a watch to every directory of the tree (existing watches are kept).
+    void watchTree() {
+#if defined(__linux__)
+        add(m_directory);
+        std::error_code error;
+        for (std::filesystem::recursive_directory_iterator it(m_directory, error), end; !error && it != end;
+             it.increment(error)) {
+            if (it->is_directory(error)) {
+                add(it->path().string());
+            }
+        }
+#endif
+    }
+
+private:
+#if defined(__linux__)
+    void add(const std::string &directory) {
+        const int wd = inotify_add_watch(m_fd, directory.c_str(),
+                                         IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE | IN_CREATE);
+        if (wd >= 0) {
+            m_directories[wd] = directory;
+        }
+    }
+    bool readable(std::chrono::milliseconds timeout) const {
+        pollfd descriptor = {m_fd, POLLIN, 0};
+        return poll(&descriptor, 1, static_cast<int>(timeout.count())) > 0 && (descriptor.revents & POLLIN) != 0;
+    }
+    void read(std::set<std::string> &paths, bool &full) {
+        alignas(inotify_event) char buffer[64 * 1024];
+        for (;;) {
+            const ssize_t length = ::read(m_fd, buffer, sizeof(buffer));
+            if (length <= 0) {
+                return;
+            }
+            for (ssize_t offset = 0; offset < length;) {
+                const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+                offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+                if (event->mask & IN_Q_OVERFLOW) {
+                    full = true;
+                    continue;
+                }
+                if (event->mask & IN_IGNORED) {
+                    m_directories.erase(event->wd);
+                    continue;
+                }
+                if (event->mask & IN_ISDIR) {
+                    // Neue, entfernte oder verschobene Verzeichnisse: alles neu vergleichen
+                    full = true;
+                    continue;
+                }
+                const auto directory = m_directories.find(event->wd);
+                if (directory == m_directories.end() || event->len == 0 ||
+                    (event->mask & (IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE)) == 0) {
+                    continue;
+                }
+                const std::filesystem::path path = std::filesystem::path(directory->second) / event->name;
+                if (path.extension() == ".json") {
+                    paths.insert(path.string());
+                }
+            }
+        }
+    }
+
+    std::unordered_map<int, std::string> m_directories;
+#endif
+    std::string m_directory;
+    int m_fd = -1;
+};
+
+//// begin public member methods
+LiveCatalog::LiveCatalog(const std::string &directory, std::size_t threads)
+    : m_directory(directory),
+    m_threads(threads),
+    m_running(false) {
+    m_files = scan();
+    std::vector<std::string> paths;
+    paths.reserve(m_files.size());
+    for (const auto &[path, file] : m_files) {
+        paths.push_back(path);
+    }
+    const Catalog catalog = Catalog::loadFiles(paths, m_threads);
+
+    auto snapshot = std::make_shared<Snapshot>();
+    snapshot->entries = catalog.entries();
+    for (std::size_t i = 0; i < snapshot->entries.size(); ++i) {
+        m_positions[snapshot->entries[i].source] = i;
+    }
+    for (const Catalog::Error &error : catalog.errors()) {
+        m_errors[error.source] = error.message;
+    }
+    snapshot->errors = catalog.errors();
+    compact(*snapshot);
+    snapshot->version = 1;
+    m_snapshot.store(std::move(snapshot));
+}
+LiveCatalog::~LiveCatalog() {
+    stop();
+}
+const std::string& LiveCatalog::directory() const {
+    return m_directory;
+}
+std::size_t LiveCatalog::refresh() {
+    std::lock_guard<std::mutex> lock(m_update);
+    const Files state = scan();
+
+    // --- Beide sortierten Zustände parallel durchlaufen ---
+    std::vector<std::string> changed;
+    auto known = m_files.begin();
+    auto now = state.begin();
+    while (known != m_files.end() || now != state.end()) {
+        if (now == state.end() || (known != m_files.end() && known->first < now->first)) {
+            changed.push_back(known->first);
+            ++known;
+        } else if (known == m_files.end() || now->first < known->first) {
+            changed.push_back(now->first);
+            ++now;
+        } else {
+            if (known->second.time != now->second.time || known->second.size != now->second.size) {
+                changed.push_back(now->first);
+            }
+            ++known;
+            ++now;
+        }
+    }
+    if (!changed.empty()) {
+        apply(changed);
+    }
+    return changed.size();
+}
+std::shared_ptr<const LiveCatalog::Snapshot> LiveCatalog::snapshot() const {
+    return m_snapshot.load();
+}
+void LiveCatalog::start() {
+    start(kInterval);
+}
+void LiveCatalog::start(std::chrono::milliseconds interval) {
+    if (m_running.exchange(true)) {
+        return;
+    }
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+    m_thread = std::thread(&LiveCatalog::watch, this, interval);
+}
+void LiveCatalog::stop() {
+    m_running.store(false);
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+bool LiveCatalog::watching() const {
+    return m_running.load();
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+void LiveCatalog::apply(const std::vector<std::string> &changed) {
+    // Aufrufer hält m_update
+    std::vector<std::string> present;
+    std::vector<std::string> gone;
+    for (const std::string &path : changed) {
+        std::error_code timeError;
+        std::error_code sizeError;
+        File file;
+        file.time = std::filesystem::last_write_time(path, timeError);
+        file.size = std::filesystem::file_size(path, sizeError);
+        if (isDriverFile(path) && !timeError && !sizeError) {
+            m_files[path] = file;
+            present.push_back(path);
+        } else {
+            m_files.erase(path);
+            gone.push_back(path);
+        }
+    }
+    const Catalog loaded = Catalog::loadFiles(present, m_threads);
+
+    const std::shared_ptr<const Snapshot> current = m_snapshot.load();
+    auto next = std::make_shared<Snapshot>();
+    next->entries = current->entries;
+    // Große Stapel: Index am Ende neu aufbauen statt jede Änderung einzusortieren
+    const bool rebuild = changed.size() * kRebuildRatio > current->entries.size();
+    if (!rebuild) {
+        next->index = current->index;
+    }
+
+    auto remove = [&](const std::string &path) {
+        const auto found = m_positions.find(path);
+        if (found == m_positions.end()) {
+            return;
+        }
+        next->entries[found->second] = Catalog::Entry();
+        if (!rebuild) {
+            next->index.erase(found->second);
+        }
+        m_positions.erase(found);
+    };
+    for (const Catalog::Entry &entry : loaded.entries()) {
+        m_errors.erase(entry.source);
+        const auto found = m_positions.find(entry.source);
+        if (found != m_positions.end()) {
+            next->entries[found->second] = entry;
+            if (!rebuild) {
+                next->index.replace(found->second, *entry.driver);
+            }
+        } else {
+            m_positions[entry.source] = next->entries.size();
+            next->entries.push_back(entry);
+            if (!rebuild) {
+                next->index.insert(*entry.driver);
+            }
+        }
+    }
+    for (const Catalog::Error &error : loaded.errors()) {
+        m_errors[error.source] = error.message;
+        remove(error.source);
+    }
+    for (const std::string &path : gone) {
+        m_errors.erase(path);
+        remove(path);
+    }
+
+    const std::size_t erased = next->entries.size() - m_positions.size();
+    if (rebuild || erased * kCompactRatio > next->entries.size()) {
+        compact(*next);
+    }
+    next->errors.reserve(m_errors.size());
+    for (const auto &[path, message] : m_errors) {
+        next->errors.push_back({path, 0, message});
+    }
+    next->version = current->version + 1;
+    m_snapshot.store(std::move(next));
+}
+void LiveCatalog::compact(Snapshot &snapshot) {
+    std::vector<Catalog::Entry> entries;
+    entries.reserve(m_positions.size());
+    std::vector<std::shared_ptr<SiVAL::AbstractDriver>> drivers;
+    drivers.reserve(m_positions.size());
+    for (Catalog::Entry &entry : snapshot.entries) {
+        if (entry.driver) {
+            m_positions[entry.source] = entries.size();
+            drivers.push_back(entry.driver);
+            entries.push_back(std::move(entry));
+        }
+    }
+    snapshot.entries = std::move(entries);
+    snapshot.index = Index(drivers);
+}
+LiveCatalog::Files LiveCatalog::scan() const {
+    Files files;
+    try {
+        std::error_code error;
+        for (std::filesystem::recursive_directory_iterator it(m_directory), end; it != end; it.increment(error)) {
+            if (error) {
+                // Während des Durchlaufs entfernte Einträge überspringen
+                error.clear();
+                continue;
+            }
+            if (it->path().extension() != ".json" || !it->is_regular_file(error)) {
+                continue;
+            }
+            File file;
+            file.time = it->last_write_time(error);
+            file.size = it->file_size(error);
+            if (!error) {
+                files[it->path().string()] = file;
+            }
+        }
+    } catch (const std::filesystem::filesystem_error &e) {
+        throw SiVAL::Exceptions::FileAccessError("Cannot read driver directory: " + m_directory + " (" + e.what() + ")");
+    }
+    return files;
+}
+void LiveCatalog::watch(std::chrono::milliseconds interval) {
+    Notifier notifier(m_directory);
+    if (notifier.valid()) {
+        // Änderungen, bevor die Watches standen, kommen nicht als Ereignis an
+        try {
+            refresh();
+        } catch (const std::exception&) {
+        }
+    }
+    auto next = std::chrono::steady_clock::now() + interval;
+    while (m_running.load()) {
+        try {
+            if (notifier.valid()) {
+                std::set<std::string> paths;
+                bool full = false;
+                if (!notifier.wait(kTick, paths, full)) {
+                    continue;
+                }
+                if (full) {
+                    notifier.watchTree();
+                    refresh();
+                } else if (!paths.empty()) {
+                    std::lock_guard<std::mutex> lock(m_update);
+                    apply(std::vector<std::string>(paths.begin(), paths.end()));
+                }
+            } else {
+                std::this_thread::sleep_for(std::min(kTick, interval));
+                if (std::chrono::steady_clock::now() >= next) {
+                    refresh();
+                    next = std::chrono::steady_clock::now() + interval;
+                }
+            }
+        } catch (const std::exception&) {
+            // Der bisherige Stand bleibt gültig, die nächste Änderung versucht es erneut
+        }
+    }
+}
+//// end private member methods
+}
+}
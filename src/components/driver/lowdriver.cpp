@@ -38,6 +38,10 @@ LowDriver::LowDriver(nlohmann::json &data)
     :SiVAL::AbstractDriver(data) {
 }
 
+LowDriver::LowDriver(const char* begin, const char* end)
+    :SiVAL::AbstractDriver(begin, end) {
+}
+
 LowDriver::~LowDriver() {
 }
 //// end public member methods
@@ -0,0 +1,188 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/components/driver/table.hpp"
+#include <sival/components/driver/database.hpp>
+#include <sival/core/exceptions.hpp>
+#include <sival/libsival.hpp>
+#include <sival/utils/parallel.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+/// Number of drivers per task of the kernels.
+static constexpr std::size_t kChunk = 4096;
+/// Peak excursion to RMS pressure at 1 m in half space, relative to P_REF: ρ0 · (2πf)² · Sd · X / (2π · √2) = kExcursion · Sd · X · f².
+static constexpr double kExcursion = SiVAL::RHO0 * std::numbers::sqrt2 * SiVAL::PI / SiVAL::P_REF;
+//// end static definitions
+
+namespace SiVAL {
+namespace Driver {
+//// begin static functions
+static double valueOf(const std::optional<double> &value) {
+    return value.has_value() ? value.value() : std::numeric_limits<double>::quiet_NaN();
+}
+//// end static functions
+
+//// begin public member methods
+Table::Table() {
+}
+Table::Table(const std::vector<std::shared_ptr<SiVAL::AbstractDriver>> &drivers) {
+    for (Column &column : m_columns) {
+        column.reserve(drivers.size());
+    }
+    for (const std::shared_ptr<SiVAL::AbstractDriver> &driver : drivers) {
+        add(row(*driver));
+    }
+}
+Table::Table(const Database &database) {
+    for (Column &column : m_columns) {
+        column.reserve(database.size());
+    }
+    for (std::size_t i = 0; i < database.size(); ++i) {
+        add(row(database.at(i)));
+    }
+}
+Table::~Table() {
+}
+std::size_t Table::append(const SiVAL::AbstractDriver &driver) {
+    add(row(driver));
+    return m_count - 1;
+}
+const Table::Column& Table::column(Parameter parameter) const {
+    if (static_cast<std::size_t>(parameter) >= kParameters) {
+        throw SiVAL::Exceptions::OutOfRange("Unknown driver parameter in table.");
+    }
+    return m_columns[static_cast<std::size_t>(parameter)];
+}
+void Table::erase(std::size_t position) {
+    if (position >= m_count) {
+        throw SiVAL::Exceptions::OutOfRange("Driver position out of range in table.");
+    }
+    for (Column &column : m_columns) {
+        column[position] = std::numeric_limits<double>::quiet_NaN();
+    }
+}
+void Table::replace(std::size_t position, const SiVAL::AbstractDriver &driver) {
+    if (position >= m_count) {
+        throw SiVAL::Exceptions::OutOfRange("Driver position out of range in table.");
+    }
+    const Row values = row(driver);
+    for (std::size_t p = 0; p < kParameters; ++p) {
+        m_columns[p][position] = values[p];
+    }
+}
+Table::Screen Table::sealed(double volume, std::size_t threads) const {
+    Screen screen;
+    sealed(volume, screen, threads);
+    return screen;
+}
+void Table::sealed(double volume, Screen &screen, std::size_t threads) const {
+    if (!(volume > 0.0) || !std::isfinite(volume)) {
+        throw SiVAL::Exceptions::OutOfRange("Box volume must be positive and finite.");
+    }
+    screen.volume = volume;
+    screen.qtc.resize(m_count);
+    screen.fc.resize(m_count);
+    screen.f3.resize(m_count);
+    screen.maxSpl.resize(m_count);
+
+    const double* __restrict fs = m_columns[static_cast<std::size_t>(Parameter::Fs)].data();
+    const double* __restrict qts = m_columns[static_cast<std::size_t>(Parameter::Qts)].data();
+    const double* __restrict vas = m_columns[static_cast<std::size_t>(Parameter::Vas)].data();
+    const double* __restrict sd = m_columns[static_cast<std::size_t>(Parameter::Sd)].data();
+    const double* __restrict xmax = m_columns[static_cast<std::size_t>(Parameter::Xmax)].data();
+    const double* __restrict sensitivity = m_columns[static_cast<std::size_t>(Parameter::Sensitivity)].data();
+    const double* __restrict pe = m_columns[static_cast<std::size_t>(Parameter::Pe)].data();
+    double* __restrict qtc = screen.qtc.data();
+    double* __restrict fc = screen.fc.data();
+    double* __restrict f3 = screen.f3.data();
+    double* __restrict maxSpl = screen.maxSpl.data();
+    const double compliance = 1.0 / volume;
+
+    const std::size_t chunks = (m_count + kChunk - 1) / kChunk;
+    SiVAL::Utils::parallelFor(chunks, [&](std::size_t chunk, std::size_t) {
+        const std::size_t begin = chunk * kChunk;
+        const std::size_t end = std::min(begin + kChunk, m_count);
+
+        // --- Abstimmung: Qtc, fc und f3 des Hochpasses 2. Ordnung ---
+        for (std::size_t i = begin; i < end; ++i) {
+            const double root = std::sqrt(1.0 + vas[i] * compliance);
+            const double q = qts[i] * root;
+            const double a = 1.0 / (q * q) - 2.0;
+            qtc[i] = q;
+            fc[i] = fs[i] * root;
+            f3[i] = fc[i] * std::sqrt(0.5 * (a + std::sqrt(a * a + 4.0)));
+        }
+
+        // --- Pegelgrenzen: thermisch (−3 dB bei f3) und durch Xmax ---
+        for (std::size_t i = begin; i < end; ++i) {
+            const double thermal = sensitivity[i] + 10.0 * std::log10(0.5 * pe[i]);
+            const double excursion = 20.0 * std::log10(kExcursion * sd[i] * xmax[i] * f3[i] * f3[i]);
+            // fmin ignoriert NaN, ohne Xmax bleibt die thermische Grenze
+            maxSpl[i] = std::fmin(thermal, excursion);
+        }
+    }, threads);
+}
+std::size_t Table::size() const {
+    return m_count;
+}
+double Table::value(std::size_t position, Parameter parameter) const {
+    if (position >= m_count || static_cast<std::size_t>(parameter) >= kParameters) {
+        throw SiVAL::Exceptions::OutOfRange("Driver position or parameter out of range in table.");
+    }
+    return m_columns[static_cast<std::size_t>(parameter)][position];
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+template<class Source>
+Table::Row Table::row(const Source &driver) {
+    // AbstractDriver und Database::View haben dieselben Zugriffsmethoden
+    return {
+        driver.fs(), driver.qts(), driver.qes(), driver.qms(), driver.vas(), driver.sd(), valueOf(driver.xmax()),
+        driver.re(), driver.le(), driver.bl(), driver.mms(), driver.sensitivity(), driver.pe(), driver.impedance(),
+    };
+}
+void Table::add(const Row &values) {
+    for (std::size_t p = 0; p < kParameters; ++p) {
+        m_columns[p].push_back(values[p]);
+    }
+    ++m_count;
+}
+//// end private member methods
+}
+}
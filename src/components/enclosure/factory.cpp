@@ -14,6 +14,8 @@
 
 //// begin project specific includes
 #include "sival/components/enclosure/factory.hpp"
+#include "sival/components/enclosure/sealed.hpp"
+#include "sival/components/enclosure/vented.hpp"
 //// end project specific includes
 
 //// begin using namespaces
@@ -36,6 +38,12 @@ namespace Enclosure {
 
 //// begin public member methods
 std::unique_ptr<AbstractEnclosure> Factory::create(EnclosureType type) {
+    switch (type) {
+    case EnclosureType::Sealed:
+        return std::make_unique<Sealed>();
+    case EnclosureType::Vented:
+        return std::make_unique<Vented>();
+    }
     return nullptr;
 }
 //// end public member methods
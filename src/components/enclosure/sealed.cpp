@@ -10,6 +10,7 @@
 //// end includes
 
 //// begin system includes
+#include <nlohmann/json.hpp>
 //// end system includes
 
 //// begin project specific includes
@@ -37,10 +38,17 @@ SiVAL::Enclosure::Sealed::Sealed()
 }
 SiVAL::Enclosure::Sealed::Sealed(const std::string &json)
     :AbstractEnclosure(SiVAL::EnclosureType::Sealed) {
-
+    readJson(json);
 }
 SiVAL::Enclosure::Sealed::~Sealed() {
 }
+std::string SiVAL::Enclosure::Sealed::toJson() {
+    nlohmann::json data;
+    data["type"] = "Sealed";
+    data["volume"] = m_volume;
+    data["baffle"] = baffleToJson();
+    return data.dump();
+}
 //// end public member methods
 
 //// begin public member methods (internal use only)
@@ -10,6 +10,7 @@
 //// end includes
 
 //// begin system includes
+#include <nlohmann/json.hpp>
 //// end system includes
 
 //// begin project specific includes
@@ -37,10 +38,17 @@ SiVAL::Enclosure::Vented::Vented()
 }
 SiVAL::Enclosure::Vented::Vented(const std::string &json)
     :AbstractEnclosure(SiVAL::EnclosureType::Vented) {
-
+    readJson(json);
 }
 SiVAL::Enclosure::Vented::~Vented() {
 }
+std::string SiVAL::Enclosure::Vented::toJson() {
+    nlohmann::json data;
+    data["type"] = "Vented";
+    data["volume"] = m_volume;
+    data["baffle"] = baffleToJson();
+    return data.dump();
+}
 //// end public member methods
 
 //// begin public member methods (internal use only)
@@ -0,0 +1,131 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <cmath>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/core/frequencygrid.hpp"
+#include <sival/core/exceptions.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+//// end static definitions
+
+namespace SiVAL {
+//// begin static functions
+FrequencyGrid FrequencyGrid::pointsPerOctave(double fmin, double fmax, std::size_t pointsPerOctave) {
+    if (fmin <= 0.0 || fmax <= fmin || pointsPerOctave == 0) {
+        throw SiVAL::Exceptions::OutOfRange("Invalid logarithmic frequency range.");
+    }
+    const std::size_t points = static_cast<std::size_t>(std::floor(std::log2(fmax / fmin) * pointsPerOctave + 1e-9)) + 1;
+    const double step = std::exp2(1.0 / static_cast<double>(pointsPerOctave));
+
+    std::vector<double> frequencies(points);
+    for (std::size_t i = 0; i < points; ++i) {
+        frequencies[i] = fmin * std::pow(step, static_cast<double>(i));
+    }
+
+    FrequencyGrid grid(std::move(frequencies));
+    grid.m_spacing = Spacing::Logarithmic;
+    return grid;
+}
+//// end static functions
+
+//// begin public member methods
+FrequencyGrid::FrequencyGrid()
+    : m_spacing(Spacing::Custom) {
+}
+FrequencyGrid::FrequencyGrid(double fmin, double fmax, std::size_t points, Spacing spacing)
+    : m_spacing(spacing) {
+    if (points < 2 || fmin <= 0.0 || fmax <= fmin) {
+        throw SiVAL::Exceptions::OutOfRange("Invalid frequency range for the grid.");
+    }
+    m_frequencies.resize(points);
+
+    const double last = static_cast<double>(points - 1);
+    if (spacing == Spacing::Logarithmic) {
+        const double ratio = std::log(fmax / fmin);
+        for (std::size_t i = 0; i < points; ++i) {
+            m_frequencies[i] = fmin * std::exp(ratio * static_cast<double>(i) / last);
+        }
+    } else {
+        const double step = (fmax - fmin) / last;
+        for (std::size_t i = 0; i < points; ++i) {
+            m_frequencies[i] = fmin + step * static_cast<double>(i);
+        }
+    }
+    // Exakte Endpunkte, damit Gitter mit gleichen Parametern identisch sind.
+    m_frequencies.front() = fmin;
+    m_frequencies.back() = fmax;
+
+    updateOmega();
+}
+FrequencyGrid::FrequencyGrid(std::vector<double> frequencies)
+    : m_frequencies(std::move(frequencies)), m_spacing(Spacing::Custom) {
+    for (std::size_t i = 0; i < m_frequencies.size(); ++i) {
+        if (m_frequencies[i] <= 0.0 || (i > 0 && m_frequencies[i] <= m_frequencies[i - 1])) {
+            throw SiVAL::Exceptions::OutOfRange("Frequencies of a grid must be positive and strictly increasing.");
+        }
+    }
+    updateOmega();
+}
+double FrequencyGrid::frequency(std::size_t index) const {
+    return m_frequencies.at(index);
+}
+const std::vector<double>& FrequencyGrid::frequencies() const {
+    return m_frequencies;
+}
+const std::vector<double>& FrequencyGrid::omega() const {
+    return m_omega;
+}
+bool FrequencyGrid::empty() const {
+    return m_frequencies.empty();
+}
+std::size_t FrequencyGrid::size() const {
+    return m_frequencies.size();
+}
+FrequencyGrid::Spacing FrequencyGrid::spacing() const {
+    return m_spacing;
+}
+bool FrequencyGrid::operator==(const FrequencyGrid &other) const {
+    return m_frequencies == other.m_frequencies;
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+void FrequencyGrid::updateOmega() {
+    m_omega.resize(m_frequencies.size());
+    for (std::size_t i = 0; i < m_frequencies.size(); ++i) {
+        m_omega[i] = 2.0 * SiVAL::PI * m_frequencies[i];
+    }
+}
+//// end private member methods
+} // namespace SiVAL
@@ -0,0 +1,196 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <algorithm>
+#include <cmath>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/core/resampler.hpp"
+#include <sival/core/exceptions.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+//// end static definitions
+
+namespace SiVAL {
+//// begin static functions
+/**
+ * @brief The weighted sum of `Taps` neighbouring values, one target point per iteration.
+ */
+template<std::size_t Taps>
+static void interpolate(const double* __restrict in, double* __restrict out, const std::size_t* __restrict index,
+                        const double* __restrict weights, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i) {
+        const double* x = in + index[i];
+        double sum = 0.0;
+        for (std::size_t t = 0; t < Taps; ++t) {
+            sum += weights[t * n + i] * x[t];
+        }
+        out[i] = sum;
+    }
+}
+//// end static functions
+
+//// begin public member methods
+Resampler::Resampler(const SiVAL::FrequencyGrid &source, const SiVAL::FrequencyGrid &target, Method method)
+    : m_source(source),
+    m_target(target),
+    m_method(method),
+    m_taps(2) {
+    const std::size_t points = source.size();
+    if (points < 2) {
+        throw SiVAL::Exceptions::OutOfRange("The source grid of a resampler needs at least two points.");
+    }
+    if (method == Method::Cubic && points >= 4) {
+        m_taps = 4;
+    }
+
+    const std::vector<double> &fs = source.frequencies();
+    const std::vector<double> &ft = target.frequencies();
+    const std::size_t n = ft.size();
+    m_index.resize(n);
+    m_weights.assign(m_taps * n, 0.0);
+
+    std::vector<double> x(points);
+    for (std::size_t k = 0; k < points; ++k) {
+        x[k] = std::log(fs[k]);
+    }
+
+    std::size_t k = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double f = ft[i];
+        if (f <= fs.front()) {
+            m_index[i] = 0;
+            m_weights[i] = 1.0;
+            continue;
+        }
+        if (f >= fs.back()) {
+            m_index[i] = points - m_taps;
+            m_weights[(m_taps - 1) * n + i] = 1.0;
+            continue;
+        }
+        // Beide Gitter sind aufsteigend: fs[k] < f <= fs[k + 1], k wandert nur vorwärts
+        while (fs[k + 1] < f) {
+            ++k;
+        }
+        const double xi = std::log(f);
+        if (m_taps == 2) {
+            const double t = (xi - x[k]) / (x[k + 1] - x[k]);
+            m_index[i] = k;
+            m_weights[i] = 1.0 - t;
+            m_weights[n + i] = t;
+        } else {
+            // Lagrange-Polynom durch vier Punkte, am Rand nach innen verschoben
+            const std::size_t first = std::min(k > 0 ? k - 1 : 0, points - 4);
+            m_index[i] = first;
+            for (std::size_t a = 0; a < 4; ++a) {
+                double w = 1.0;
+                for (std::size_t b = 0; b < 4; ++b) {
+                    if (a != b) {
+                        w *= (xi - x[first + b]) / (x[first + a] - x[first + b]);
+                    }
+                }
+                m_weights[a * n + i] = w;
+            }
+        }
+    }
+}
+Resampler::~Resampler() {
+}
+void Resampler::apply(const double* in, double* out) const {
+    const std::size_t n = m_target.size();
+    if (m_taps == 4) {
+        interpolate<4>(in, out, m_index.data(), m_weights.data(), n);
+    } else {
+        interpolate<2>(in, out, m_index.data(), m_weights.data(), n);
+    }
+}
+void Resampler::apply(const std::vector<double> &in, std::vector<double> &out) const {
+    check(in.size());
+    if (&in == &out) {
+        // In-place: resize würde die Eingabe verändern, daher über einen Puffer
+        std::vector<double> result(m_target.size());
+        apply(in.data(), result.data());
+        out = std::move(result);
+        return;
+    }
+    out.resize(m_target.size());
+    apply(in.data(), out.data());
+}
+void Resampler::apply(const SiVAL::Spectrum &in, SiVAL::Spectrum &out) const {
+    check(in.size());
+    if (&in == &out) {
+        SiVAL::Spectrum result(m_target.size());
+        apply(in.real(), result.real());
+        apply(in.imag(), result.imag());
+        out = std::move(result);
+        return;
+    }
+    out.resize(m_target.size());
+    apply(in.real(), out.real());
+    apply(in.imag(), out.imag());
+}
+void Resampler::applyPolar(const std::vector<double> &magnitude, const std::vector<double> &phase,
+                           std::vector<double> &outMagnitude, std::vector<double> &outPhase) const {
+    check(magnitude.size());
+    check(phase.size());
+    const std::size_t points = phase.size();
+
+    // Phase ohne Sprünge um 2 pi
+    std::vector<double> unwrapped(points);
+    unwrapped[0] = phase[0];
+    for (std::size_t k = 1; k < points; ++k) {
+        const double step = phase[k] - phase[k - 1];
+        unwrapped[k] = unwrapped[k - 1] + step - 2.0 * SiVAL::PI * std::round(step / (2.0 * SiVAL::PI));
+    }
+    apply(magnitude, outMagnitude);
+    outPhase.resize(m_target.size());
+    apply(unwrapped.data(), outPhase.data());
+}
+Resampler::Method Resampler::method() const {
+    return m_method;
+}
+const SiVAL::FrequencyGrid& Resampler::source() const {
+    return m_source;
+}
+const SiVAL::FrequencyGrid& Resampler::target() const {
+    return m_target;
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+void Resampler::check(std::size_t size) const {
+    if (size != m_source.size()) {
+        throw SiVAL::Exceptions::OutOfRange("The data does not match the source grid of the resampler.");
+    }
+}
+//// end private member methods
+} // namespace SiVAL
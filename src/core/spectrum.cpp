@@ -0,0 +1,148 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <algorithm>
+#include <cmath>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/core/spectrum.hpp"
+#include <sival/core/exceptions.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+//// end static definitions
+
+namespace SiVAL {
+//// begin static functions
+//// end static functions
+
+//// begin public member methods
+Spectrum::Spectrum() {
+}
+Spectrum::Spectrum(std::size_t size)
+    : m_real(size, 0.0), m_imag(size, 0.0) {
+}
+void Spectrum::accumulate(const Spectrum &other) {
+    if (other.size() != size()) {
+        throw SiVAL::Exceptions::OutOfRange("Spectra of different size cannot be accumulated.");
+    }
+    double* __restrict re = m_real.data();
+    double* __restrict im = m_imag.data();
+    const double* __restrict ore = other.m_real.data();
+    const double* __restrict oim = other.m_imag.data();
+    const std::size_t n = size();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        re[i] += ore[i];
+        im[i] += oim[i];
+    }
+}
+std::complex<double> Spectrum::at(std::size_t index) const {
+    return {m_real.at(index), m_imag.at(index)};
+}
+void Spectrum::fill(std::complex<double> value) {
+    std::fill(m_real.begin(), m_real.end(), value.real());
+    std::fill(m_imag.begin(), m_imag.end(), value.imag());
+}
+double* Spectrum::imag() {
+    return m_imag.data();
+}
+const double* Spectrum::imag() const {
+    return m_imag.data();
+}
+std::vector<double> Spectrum::magnitude() const {
+    std::vector<double> result(size());
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        result[i] = std::sqrt(m_real[i] * m_real[i] + m_imag[i] * m_imag[i]);
+    }
+    return result;
+}
+std::vector<double> Spectrum::magnitudeDb(double reference) const {
+    // 20*log10(|H|/ref) == 10*log10(|H|^2/ref^2), so the square root is not needed.
+    const double ref2 = reference * reference;
+    std::vector<double> result(size());
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        result[i] = 10.0 * std::log10((m_real[i] * m_real[i] + m_imag[i] * m_imag[i]) / ref2);
+    }
+    return result;
+}
+void Spectrum::multiply(const Spectrum &other) {
+    if (other.size() != size()) {
+        throw SiVAL::Exceptions::OutOfRange("Spectra of different size cannot be multiplied.");
+    }
+    double* __restrict re = m_real.data();
+    double* __restrict im = m_imag.data();
+    const double* __restrict ore = other.m_real.data();
+    const double* __restrict oim = other.m_imag.data();
+    const std::size_t n = size();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        const double r = re[i] * ore[i] - im[i] * oim[i];
+        const double j = re[i] * oim[i] + im[i] * ore[i];
+        re[i] = r;
+        im[i] = j;
+    }
+}
+std::vector<double> Spectrum::phase() const {
+    std::vector<double> result(size());
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        result[i] = std::atan2(m_imag[i], m_real[i]);
+    }
+    return result;
+}
+double* Spectrum::real() {
+    return m_real.data();
+}
+const double* Spectrum::real() const {
+    return m_real.data();
+}
+void Spectrum::resize(std::size_t size) {
+    m_real.resize(size, 0.0);
+    m_imag.resize(size, 0.0);
+}
+void Spectrum::scale(double factor) {
+    for (std::size_t i = 0; i < m_real.size(); ++i) {
+        m_real[i] *= factor;
+        m_imag[i] *= factor;
+    }
+}
+void Spectrum::set(std::size_t index, std::complex<double> value) {
+    m_real.at(index) = value.real();
+    m_imag.at(index) = value.imag();
+}
+std::size_t Spectrum::size() const {
+    return m_real.size();
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+//// end private member methods
+} // namespace SiVAL
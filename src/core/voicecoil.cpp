@@ -0,0 +1,247 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <cmath>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/core/voicecoil.hpp"
+#include <sival/core/exceptions.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+//// end static definitions
+
+namespace SiVAL {
+//// begin static functions
+VoiceCoil::Model VoiceCoil::modelFromString(const std::string &name) {
+    if (name == "Simple") {
+        return Model::Simple;
+    }
+    if (name == "LR2") {
+        return Model::LR2;
+    }
+    if (name == "Wright") {
+        return Model::Wright;
+    }
+    if (name == "Leach") {
+        return Model::Leach;
+    }
+    throw SiVAL::Exceptions::OutOfRange("Unknown voice coil model: " + name);
+}
+std::string VoiceCoil::modelToString(Model model) {
+    switch (model) {
+    case Model::Simple:
+        return "Simple";
+    case Model::LR2:
+        return "LR2";
+    case Model::Wright:
+        return "Wright";
+    case Model::Leach:
+        return "Leach";
+    }
+    return "Unknown";
+}
+//// end static functions
+
+//// begin public member methods
+void VoiceCoil::derivatives(double omega, double &real, double &imag, double* dReal, double* dImag) const {
+    const double w = omega;
+    switch (model) {
+    case Model::Simple:
+        real = 0.0;
+        imag = w * le;
+        dReal[0] = 0.0;
+        dImag[0] = imag;
+        break;
+    case Model::LR2: {
+        // Z2 = R2 X / (R2 + X), X = j w L2
+        const double x = w * l2;
+        const double d = 1.0 / (r2 * r2 + x * x);
+        const double zr = r2 * x * x * d;
+        const double zi = r2 * r2 * x * d;
+        real = zr;
+        imag = w * le + zi;
+        dReal[0] = 0.0;
+        dImag[0] = w * le;
+        // R2 dZ2/dR2 = Z2 X / (R2 + X), L2 dZ2/dL2 = Z2 R2 / (R2 + X)
+        const double ar = x * x * d;
+        const double ai = x * r2 * d;
+        dReal[1] = zr * ar - zi * ai;
+        dImag[1] = zr * ai + zi * ar;
+        const double br = r2 * r2 * d;
+        const double bi = -r2 * x * d;
+        dReal[2] = zr * br - zi * bi;
+        dImag[2] = zr * bi + zi * br;
+        break;
+    }
+    case Model::Wright: {
+        const double lw = std::log(w);
+        const double a = krm * std::exp(erm * lw);
+        const double b = kxm * std::exp(exm * lw);
+        real = a;
+        imag = b;
+        dReal[0] = a;
+        dImag[0] = 0.0;
+        dReal[1] = erm * lw * a;
+        dImag[1] = 0.0;
+        dReal[2] = 0.0;
+        dImag[2] = b;
+        dReal[3] = 0.0;
+        dImag[3] = exm * lw * b;
+        break;
+    }
+    case Model::Leach: {
+        // K (j w)^n = K w^n e^(j n pi / 2)
+        const double lw = std::log(w);
+        const double m = k * std::exp(n * lw);
+        const double phi = 0.5 * SiVAL::PI * n;
+        real = m * std::cos(phi);
+        imag = m * std::sin(phi);
+        dReal[0] = real;
+        dImag[0] = imag;
+        // n dZ/dn = n (ln w + j pi / 2) Z
+        dReal[1] = n * (lw * real - 0.5 * SiVAL::PI * imag);
+        dImag[1] = n * (lw * imag + 0.5 * SiVAL::PI * real);
+        break;
+    }
+    }
+}
+void VoiceCoil::evaluate(const double* omega, double* real, double* imag, std::size_t count) const {
+    const double* __restrict w = omega;
+    double* __restrict zr = real;
+    double* __restrict zi = imag;
+    switch (model) {
+    case Model::Simple:
+        for (std::size_t i = 0; i < count; ++i) {
+            zr[i] = 0.0;
+            zi[i] = w[i] * le;
+        }
+        break;
+    case Model::LR2:
+        for (std::size_t i = 0; i < count; ++i) {
+            const double x = w[i] * l2;
+            const double d = r2 * r2 + x * x;
+            const double s = d > 0.0 ? r2 * x / d : 0.0;
+            zr[i] = s * x;
+            zi[i] = w[i] * le + s * r2;
+        }
+        break;
+    case Model::Wright:
+        for (std::size_t i = 0; i < count; ++i) {
+            const double lw = std::log(w[i]);
+            zr[i] = krm * std::exp(erm * lw);
+            zi[i] = kxm * std::exp(exm * lw);
+        }
+        break;
+    case Model::Leach: {
+        const double c = k * std::cos(0.5 * SiVAL::PI * n);
+        const double s = k * std::sin(0.5 * SiVAL::PI * n);
+        for (std::size_t i = 0; i < count; ++i) {
+            const double m = std::exp(n * std::log(w[i]));
+            zr[i] = c * m;
+            zi[i] = s * m;
+        }
+        break;
+    }
+    }
+}
+std::size_t VoiceCoil::parameterCount() const {
+    switch (model) {
+    case Model::Simple:
+        return 1;
+    case Model::LR2:
+        return 3;
+    case Model::Wright:
+        return 4;
+    case Model::Leach:
+        return 2;
+    }
+    return 0;
+}
+void VoiceCoil::parameters(double* values) const {
+    switch (model) {
+    case Model::Simple:
+        values[0] = le;
+        break;
+    case Model::LR2:
+        values[0] = le;
+        values[1] = r2;
+        values[2] = l2;
+        break;
+    case Model::Wright:
+        values[0] = krm;
+        values[1] = erm;
+        values[2] = kxm;
+        values[3] = exm;
+        break;
+    case Model::Leach:
+        values[0] = k;
+        values[1] = n;
+        break;
+    }
+}
+VoiceCoil VoiceCoil::scaled(double factor) const {
+    VoiceCoil coil = *this;
+    coil.le *= factor;
+    coil.r2 *= factor;
+    coil.l2 *= factor;
+    coil.krm *= factor;
+    coil.kxm *= factor;
+    coil.k *= factor;
+    return coil;
+}
+void VoiceCoil::setParameters(const double* values) {
+    switch (model) {
+    case Model::Simple:
+        le = values[0];
+        break;
+    case Model::LR2:
+        le = values[0];
+        r2 = values[1];
+        l2 = values[2];
+        break;
+    case Model::Wright:
+        krm = values[0];
+        erm = values[1];
+        kxm = values[2];
+        exm = values[3];
+        break;
+    case Model::Leach:
+        k = values[0];
+        n = values[1];
+        break;
+    }
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+//// end private member methods
+} // namespace SiVAL
@@ -0,0 +1,94 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+//// end system includes
+
+//// begin project specific includes
+#include "sival/crossover/network.hpp"
+#include <sival/core/exceptions.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+//// end static definitions
+
+namespace SiVAL::Crossover {
+//// begin static functions
+//// end static functions
+
+//// begin public member methods
+Network::Network()
+    : m_componentCount(0) {
+}
+Network::~Network() {
+}
+Network& Network::addBranch(Branch branch) {
+    if (branch.components.empty()) {
+        throw SiVAL::Exceptions::OutOfRange("A crossover branch must contain at least one component.");
+    }
+    m_componentCount += branch.components.size();
+    m_branches.push_back(std::move(branch));
+    return *this;
+}
+Network& Network::addSeries(Component component) {
+    return addBranch(Branch{Branch::Placement::Series, Branch::Combination::Series, {component}});
+}
+Network& Network::addShunt(Component component) {
+    return addBranch(Branch{Branch::Placement::Shunt, Branch::Combination::Series, {component}});
+}
+const std::vector<Branch>& Network::branches() const {
+    return m_branches;
+}
+const Component& Network::component(std::size_t index) const {
+    return const_cast<Network*>(this)->locate(index);
+}
+std::size_t Network::componentCount() const {
+    return m_componentCount;
+}
+bool Network::empty() const {
+    return m_branches.empty();
+}
+void Network::setValue(std::size_t index, double value) {
+    locate(index).value = value;
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+Component& Network::locate(std::size_t index) {
+    const std::size_t requested = index;
+    for (Branch &branch : m_branches) {
+        if (index < branch.components.size()) {
+            return branch.components[index];
+        }
+        index -= branch.components.size();
+    }
+    throw SiVAL::Exceptions::OutOfRange("There is no crossover component with index: " + std::to_string(requested));
+}
+//// end private member methods
+} // namespace SiVAL::Crossover
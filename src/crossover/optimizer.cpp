@@ -0,0 +1,397 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <algorithm>
+#include <cmath>
+#include <random>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/crossover/optimizer.hpp"
+#include <sival/core/exceptions.hpp>
+#include <sival/response/system/summation.hpp>
+#include <sival/utils/parallel.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+/// Step of the central differences in logarithmic coordinates (0.01 % of the value).
+static constexpr double kGradientStep = 1e-4;
+/// Sufficient decrease constant of the Armijo condition.
+static constexpr double kArmijo = 1e-4;
+/// Maximum number of step halvings in the line search.
+static constexpr int kLineSearchSteps = 30;
+//// end static definitions
+
+namespace SiVAL::Crossover {
+//// begin static functions
+//// end static functions
+
+/**
+ * @brief Per-thread state of a search. All buffers are allocated once per worker.
+ */
+struct Optimizer::Workspace {
+    explicit Workspace(const Solver &crossover, std::size_t points, std::size_t parameters)
+        : solver(crossover), sum(points),
+        lower(parameters), upper(parameters), probe(parameters), gradient(parameters),
+        nextGradient(parameters), direction(parameters), trial(parameters), step(parameters),
+        change(parameters), hessianChange(parameters), hessian(parameters * parameters) {
+    }
+
+    Solver solver;
+    SiVAL::Spectrum sum;
+    std::vector<double> lower;
+    std::vector<double> upper;
+    std::vector<double> probe;
+    std::vector<double> gradient;
+    std::vector<double> nextGradient;
+    std::vector<double> direction;
+    std::vector<double> trial;
+    std::vector<double> step;
+    std::vector<double> change;
+    std::vector<double> hessianChange;
+    std::vector<double> hessian;
+    std::size_t evaluations = 0;
+};
+
+//// begin public member methods
+Optimizer::Optimizer(const SiVAL::Response::Summation &summation, const Solver &crossover)
+    : m_crossover(crossover),
+    m_unfiltered(crossover.grid().size()),
+    m_impedanceFloor(0.0),
+    m_impedanceWeight(1.0) {
+    if (!(summation.grid() == crossover.grid())) {
+        throw SiVAL::Exceptions::OutOfRange("The summation and the crossover use different frequency grids.");
+    }
+    if (summation.source().resistance() != crossover.sourceResistance()) {
+        throw SiVAL::Exceptions::OutOfRange("The summation and the crossover use different source resistances.");
+    }
+    for (SiVAL::DriverRole role : summation.roles()) {
+        if (m_crossover.contains(role)) {
+            m_filtered.push_back({role, summation.terminalResponse(role)});
+        } else {
+            m_unfiltered.accumulate(summation.roleResponse(role));
+        }
+    }
+    m_crossover.solve();
+}
+Optimizer::~Optimizer() {
+}
+void Optimizer::addParameter(SiVAL::DriverRole role, std::size_t index, double minimum, double maximum) {
+    m_crossover.network(role).component(index);
+    if (minimum <= 0.0 || maximum <= minimum) {
+        throw SiVAL::Exceptions::OutOfRange("The bounds of a crossover parameter must satisfy 0 < minimum < maximum.");
+    }
+    m_parameters.push_back({role, index, minimum, maximum});
+}
+void Optimizer::apply(const Result &result, Solver &crossover) const {
+    for (std::size_t k = 0; k < m_parameters.size() && k < result.values.size(); ++k) {
+        crossover.setComponentValue(m_parameters[k].role, m_parameters[k].index, result.values[k]);
+    }
+}
+double Optimizer::cost(const std::vector<double> &values) const {
+    if (values.size() != m_parameters.size() || m_target.empty()) {
+        throw SiVAL::Exceptions::OutOfRange("The number of values does not match the parameters or no target is set.");
+    }
+    Workspace workspace(m_crossover, m_target.size(), m_parameters.size());
+    std::vector<double> x(values.size());
+    for (std::size_t k = 0; k < values.size(); ++k) {
+        x[k] = std::log(values[k]);
+    }
+    return evaluate(workspace, x);
+}
+Optimizer::Result Optimizer::optimize() const {
+    return optimize(Settings());
+}
+Optimizer::Result Optimizer::optimize(const Settings &settings) const {
+    if (m_parameters.empty() || m_target.empty()) {
+        throw SiVAL::Exceptions::OutOfRange("The optimizer needs at least one parameter and a target.");
+    }
+    const std::size_t parameters = m_parameters.size();
+    const std::size_t starts = std::max<std::size_t>(1, settings.starts);
+
+    // Startpunkte vorab erzeugen, damit das Ergebnis nicht von der Threadanzahl abhängt.
+    std::vector<std::vector<double>> initial(starts, std::vector<double>(parameters));
+    std::mt19937_64 random(settings.seed);
+    for (std::size_t s = 0; s < starts; ++s) {
+        for (std::size_t k = 0; k < parameters; ++k) {
+            const Parameter &p = m_parameters[k];
+            const double lower = std::log(p.minimum);
+            const double upper = std::log(p.maximum);
+            if (s == 0) {
+                const double current = m_crossover.network(p.role).component(p.index).value;
+                initial[s][k] = std::clamp(std::log(std::max(current, p.minimum)), lower, upper);
+            } else {
+                initial[s][k] = std::uniform_real_distribution<double>(lower, upper)(random);
+            }
+        }
+    }
+
+    const std::size_t workers = SiVAL::Utils::threadCount(settings.threads, starts);
+    std::vector<Workspace> workspaces;
+    workspaces.reserve(workers);
+    for (std::size_t w = 0; w < workers; ++w) {
+        workspaces.emplace_back(m_crossover, m_target.size(), parameters);
+    }
+
+    std::vector<Result> results(starts);
+    SiVAL::Utils::parallelFor(starts, [&](std::size_t start, std::size_t worker) {
+        results[start] = search(workspaces[worker], initial[start], settings);
+    }, workers);
+
+    Result best = results.front();
+    std::size_t evaluations = 0;
+    for (const Result &result : results) {
+        evaluations += result.evaluations;
+        if (result.cost < best.cost) {
+            best = result;
+        }
+    }
+    best.evaluations = evaluations;
+    return best;
+}
+const std::vector<Optimizer::Parameter>& Optimizer::parameters() const {
+    return m_parameters;
+}
+void Optimizer::setImpedanceFloor(double ohm, double weight) {
+    m_impedanceFloor = ohm;
+    m_impedanceWeight = weight;
+}
+void Optimizer::setTarget(std::vector<double> spl, std::vector<double> weights) {
+    const std::size_t n = m_crossover.grid().size();
+    if (spl.size() != n || (!weights.empty() && weights.size() != n)) {
+        throw SiVAL::Exceptions::OutOfRange("The target does not match the frequency grid.");
+    }
+    if (weights.empty()) {
+        weights.assign(n, 1.0);
+    }
+    m_target = std::move(spl);
+    m_weights = std::move(weights);
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+double Optimizer::evaluate(Workspace &workspace, const std::vector<double> &x) const {
+    ++workspace.evaluations;
+
+    // Only changed values mark their role as modified, so a partial derivative re-solves one network.
+    for (std::size_t k = 0; k < m_parameters.size(); ++k) {
+        const Parameter &p = m_parameters[k];
+        const double value = std::exp(x[k]);
+        if (workspace.solver.network(p.role).component(p.index).value != value) {
+            workspace.solver.setComponentValue(p.role, p.index, value);
+        }
+    }
+    workspace.solver.solve();
+
+    const std::size_t n = m_target.size();
+    double* __restrict sr = workspace.sum.real();
+    double* __restrict si = workspace.sum.imag();
+    std::copy(m_unfiltered.real(), m_unfiltered.real() + n, sr);
+    std::copy(m_unfiltered.imag(), m_unfiltered.imag() + n, si);
+
+    for (const FilteredRole &role : m_filtered) {
+        const SiVAL::Spectrum &transfer = workspace.solver.transfer(role.role);
+        const double* __restrict pr = role.pressure.real();
+        const double* __restrict pi = role.pressure.imag();
+        const double* __restrict hr = transfer.real();
+        const double* __restrict hi = transfer.imag();
+        for (std::size_t i = 0; i < n; ++i) {
+            sr[i] += pr[i] * hr[i] - pi[i] * hi[i];
+            si[i] += pr[i] * hi[i] + pi[i] * hr[i];
+        }
+    }
+
+    const double ref2 = SiVAL::P_REF * SiVAL::P_REF;
+    const double* __restrict target = m_target.data();
+    const double* __restrict weights = m_weights.data();
+    double error = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double d = 10.0 * std::log10((sr[i] * sr[i] + si[i] * si[i]) / ref2) - target[i];
+        error += weights[i] * d * d;
+    }
+
+    if (m_impedanceFloor > 0.0) {
+        const SiVAL::Spectrum &z = workspace.solver.systemImpedance();
+        const double* __restrict zr = z.real();
+        const double* __restrict zi = z.imag();
+        double penalty = 0.0;
+        for (std::size_t i = 0; i < n; ++i) {
+            const double d = std::max(0.0, m_impedanceFloor - std::sqrt(zr[i] * zr[i] + zi[i] * zi[i]));
+            penalty += d * d;
+        }
+        error += m_impedanceWeight * penalty;
+    }
+    return error / static_cast<double>(n);
+}
+void Optimizer::gradient(Workspace &workspace, const std::vector<double> &x, double fx, std::vector<double> &g) const {
+    std::vector<double> &probe = workspace.probe;
+    probe = x;
+    for (std::size_t k = 0; k < x.size(); ++k) {
+        const double up = std::min(x[k] + kGradientStep, workspace.upper[k]);
+        const double down = std::max(x[k] - kGradientStep, workspace.lower[k]);
+
+        probe[k] = up;
+        const double fUp = up == x[k] ? fx : evaluate(workspace, probe);
+        probe[k] = down;
+        const double fDown = down == x[k] ? fx : evaluate(workspace, probe);
+        probe[k] = x[k];
+
+        g[k] = up > down ? (fUp - fDown) / (up - down) : 0.0;
+    }
+}
+Optimizer::Result Optimizer::search(Workspace &workspace, std::vector<double> x, const Settings &settings) const {
+    const std::size_t p = x.size();
+    workspace.evaluations = 0;
+    for (std::size_t k = 0; k < p; ++k) {
+        workspace.lower[k] = std::log(m_parameters[k].minimum);
+        workspace.upper[k] = std::log(m_parameters[k].maximum);
+    }
+
+    std::vector<double> &g = workspace.gradient;
+    std::vector<double> &gNext = workspace.nextGradient;
+    std::vector<double> &d = workspace.direction;
+    std::vector<double> &trial = workspace.trial;
+    std::vector<double> &s = workspace.step;
+    std::vector<double> &y = workspace.change;
+    std::vector<double> &hy = workspace.hessianChange;
+    std::vector<double> &h = workspace.hessian;
+
+    double f = evaluate(workspace, x);
+    gradient(workspace, x, f, g);
+
+    // Start with a scaled identity so that the first step changes a value by at most a factor e.
+    auto resetHessian = [&]() {
+        double scale = 0.0;
+        for (std::size_t k = 0; k < p; ++k) {
+            scale = std::max(scale, std::abs(g[k]));
+        }
+        scale = scale > 0.0 ? 1.0 / scale : 1.0;
+        std::fill(h.begin(), h.end(), 0.0);
+        for (std::size_t k = 0; k < p; ++k) {
+            h[k * p + k] = scale;
+        }
+    };
+    resetHessian();
+
+    std::size_t iteration = 0;
+    for (; iteration < settings.iterations; ++iteration) {
+        // Projected quasi-Newton direction d = -H g
+        double slope = 0.0;
+        for (int attempt = 0; attempt < 2; ++attempt) {
+            slope = 0.0;
+            for (std::size_t r = 0; r < p; ++r) {
+                double v = 0.0;
+                for (std::size_t c = 0; c < p; ++c) {
+                    v -= h[r * p + c] * g[c];
+                }
+                if ((x[r] <= workspace.lower[r] && v < 0.0) || (x[r] >= workspace.upper[r] && v > 0.0)) {
+                    v = 0.0;
+                }
+                d[r] = v;
+                slope += v * g[r];
+            }
+            if (slope < 0.0) {
+                break;
+            }
+            resetHessian();
+        }
+        if (slope >= 0.0) {
+            break;
+        }
+
+        // Armijo line search on the projected step
+        bool accepted = false;
+        double fTrial = f;
+        double t = 1.0;
+        for (int ls = 0; ls < kLineSearchSteps; ++ls, t *= 0.5) {
+            double decrease = 0.0;
+            for (std::size_t k = 0; k < p; ++k) {
+                trial[k] = std::clamp(x[k] + t * d[k], workspace.lower[k], workspace.upper[k]);
+                s[k] = trial[k] - x[k];
+                decrease += g[k] * s[k];
+            }
+            fTrial = evaluate(workspace, trial);
+            if (fTrial <= f + kArmijo * decrease) {
+                accepted = true;
+                break;
+            }
+        }
+        if (!accepted) {
+            break;
+        }
+
+        gradient(workspace, trial, fTrial, gNext);
+
+        // BFGS update of the inverse Hessian
+        double sy = 0.0;
+        for (std::size_t k = 0; k < p; ++k) {
+            y[k] = gNext[k] - g[k];
+            sy += s[k] * y[k];
+        }
+        if (sy > 1e-12) {
+            double yhy = 0.0;
+            for (std::size_t r = 0; r < p; ++r) {
+                double v = 0.0;
+                for (std::size_t c = 0; c < p; ++c) {
+                    v += h[r * p + c] * y[c];
+                }
+                hy[r] = v;
+                yhy += y[r] * v;
+            }
+            const double a = (sy + yhy) / (sy * sy);
+            for (std::size_t r = 0; r < p; ++r) {
+                for (std::size_t c = 0; c < p; ++c) {
+                    h[r * p + c] += a * s[r] * s[c] - (hy[r] * s[c] + s[r] * hy[c]) / sy;
+                }
+            }
+        }
+
+        const bool converged = std::abs(f - fTrial) <= settings.tolerance * (1.0 + std::abs(f));
+        x.swap(trial);
+        g.swap(gNext);
+        f = fTrial;
+        if (converged) {
+            ++iteration;
+            break;
+        }
+    }
+
+    Result result;
+    result.values.resize(p);
+    for (std::size_t k = 0; k < p; ++k) {
+        result.values[k] = std::exp(x[k]);
+    }
+    result.cost = f;
+    result.iterations = iteration;
+    result.evaluations = workspace.evaluations;
+    return result;
+}
+//// end private member methods
+} // namespace SiVAL::Crossover
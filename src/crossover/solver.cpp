@@ -0,0 +1,349 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <algorithm>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/crossover/solver.hpp"
+#include <sival/core/exceptions.hpp>
+#include <sival/response/system/drivermodel.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+//// end static definitions
+
+namespace SiVAL::Crossover {
+//// begin static functions
+/**
+ * @brief Adds the impedance of a component to zr/zi.
+ */
+static void addImpedance(const Component &c, const double* __restrict w, const double* __restrict iw,
+                         double* __restrict zr, double* __restrict zi, std::size_t n) {
+    switch (c.type) {
+    case Component::Type::Inductor:
+        for (std::size_t i = 0; i < n; ++i) {
+            zr[i] += c.esr;
+            zi[i] += w[i] * c.value;
+        }
+        break;
+    case Component::Type::Capacitor: {
+        const double inv = 1.0 / c.value;
+        for (std::size_t i = 0; i < n; ++i) {
+            zr[i] += c.esr;
+            zi[i] -= iw[i] * inv;
+        }
+        break;
+    }
+    case Component::Type::Resistor:
+        for (std::size_t i = 0; i < n; ++i) {
+            zr[i] += c.value + c.esr;
+        }
+        break;
+    }
+}
+
+/**
+ * @brief Adds the admittance of a component to yr/yi.
+ */
+static void addAdmittance(const Component &c, const double* __restrict w, const double* __restrict iw,
+                          double* __restrict yr, double* __restrict yi, std::size_t n) {
+    if (c.type == Component::Type::Resistor) {
+        const double g = 1.0 / (c.value + c.esr);
+        for (std::size_t i = 0; i < n; ++i) {
+            yr[i] += g;
+        }
+        return;
+    }
+    if (c.esr == 0.0) {
+        // Ideale Bauteile: keine Division pro Frequenz notwendig
+        if (c.type == Component::Type::Capacitor) {
+            for (std::size_t i = 0; i < n; ++i) {
+                yi[i] += w[i] * c.value;
+            }
+        } else {
+            const double inv = 1.0 / c.value;
+            for (std::size_t i = 0; i < n; ++i) {
+                yi[i] -= iw[i] * inv;
+            }
+        }
+        return;
+    }
+    // 1 / (a + jb) = (a - jb) / (a^2 + b^2)
+    const bool inductor = c.type == Component::Type::Inductor;
+    const double inv = inductor ? c.value : -1.0 / c.value;
+    const double* __restrict x = inductor ? w : iw;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double b = x[i] * inv;
+        const double d = 1.0 / (c.esr * c.esr + b * b);
+        yr[i] += c.esr * d;
+        yi[i] -= b * d;
+    }
+}
+
+/**
+ * @brief Replaces r/i by its reciprocal.
+ */
+static void invert(double* __restrict r, double* __restrict i, std::size_t n) {
+    for (std::size_t k = 0; k < n; ++k) {
+        const double d = 1.0 / (r[k] * r[k] + i[k] * i[k]);
+        r[k] *= d;
+        i[k] *= -d;
+    }
+}
+//// end static functions
+
+//// begin public member methods
+Solver::Solver(const SiVAL::FrequencyGrid &grid)
+    : m_grid(grid),
+    m_sourceResistance(0.0),
+    m_sourceModified(false) {
+    m_inverseOmega.resize(grid.size());
+    for (std::size_t i = 0; i < grid.size(); ++i) {
+        m_inverseOmega[i] = 1.0 / grid.omega()[i];
+    }
+    m_systemImpedance.resize(grid.size());
+}
+Solver::~Solver() {
+}
+bool Solver::contains(SiVAL::DriverRole role) const {
+    auto it = m_roles.find(role);
+    return it != m_roles.end() && it->second.hasLoad;
+}
+const SiVAL::FrequencyGrid& Solver::grid() const {
+    return m_grid;
+}
+const SiVAL::Spectrum& Solver::inputImpedance(SiVAL::DriverRole role) const {
+    return entry(role).input;
+}
+const Network& Solver::network(SiVAL::DriverRole role) const {
+    return entry(role).network;
+}
+std::vector<SiVAL::DriverRole> Solver::roles() const {
+    std::vector<SiVAL::DriverRole> result;
+    result.reserve(m_roles.size());
+    for (const auto &[role, data] : m_roles) {
+        result.push_back(role);
+    }
+    return result;
+}
+void Solver::setComponentValue(SiVAL::DriverRole role, std::size_t index, double value) {
+    Role &data = entry(role);
+    data.network.setValue(index, value);
+    data.modified = true;
+}
+void Solver::setLoad(SiVAL::DriverRole role, const SiVAL::Spectrum &impedance) {
+    const std::size_t n = m_grid.size();
+    if (impedance.size() != n) {
+        throw SiVAL::Exceptions::OutOfRange("The load of role " + SiVAL::roleToString(role) + " does not match the frequency grid.");
+    }
+    Role &data = m_roles[role];
+    data.load = impedance;
+    data.loadAdmittance = impedance;
+    invert(data.loadAdmittance.real(), data.loadAdmittance.imag(), n);
+
+    // Arbeitspuffer einmalig anlegen, solve() alloziert danach nicht mehr.
+    data.voltage.resize(n);
+    data.current.resize(n);
+    data.branch.resize(n);
+    data.ladder.resize(n);
+    data.transfer.resize(n);
+    data.input.resize(n);
+    data.hasLoad = true;
+    data.modified = true;
+}
+void Solver::setLoad(SiVAL::DriverRole role, const SiVAL::Response::DriverModel &model) {
+    SiVAL::Spectrum impedance;
+    model.impedance(m_grid, impedance);
+    setLoad(role, impedance);
+    setSourceResistance(model.coefficients().rg);
+}
+void Solver::setNetwork(SiVAL::DriverRole role, Network network) {
+    Role &data = m_roles[role];
+    data.network = std::move(network);
+    data.modified = true;
+}
+void Solver::setSourceResistance(double resistance) {
+    if (resistance < 0.0) {
+        throw SiVAL::Exceptions::OutOfRange("The source resistance must not be negative.");
+    }
+    if (resistance != m_sourceResistance) {
+        m_sourceResistance = resistance;
+        m_sourceModified = true;
+    }
+}
+double Solver::sourceResistance() const {
+    return m_sourceResistance;
+}
+void Solver::solve() {
+    bool modified = false;
+    for (auto &[role, data] : m_roles) {
+        if (!data.hasLoad) {
+            throw SiVAL::Exceptions::OutOfRange("There is no load for the role: " + SiVAL::roleToString(role));
+        }
+        if (data.modified) {
+            solveRole(data);
+            data.modified = false;
+            modified = true;
+        }
+    }
+    if (modified || m_sourceModified) {
+        updateSystemImpedance();
+        m_sourceModified = false;
+    }
+}
+const SiVAL::Spectrum& Solver::systemImpedance() const {
+    return m_systemImpedance;
+}
+const SiVAL::Spectrum& Solver::transfer(SiVAL::DriverRole role) const {
+    return entry(role).transfer;
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+Solver::Role& Solver::entry(SiVAL::DriverRole role) {
+    auto it = m_roles.find(role);
+    if (it == m_roles.end()) {
+        throw SiVAL::Exceptions::OutOfRange("There is no crossover for the role: " + SiVAL::roleToString(role));
+    }
+    return it->second;
+}
+const Solver::Role& Solver::entry(SiVAL::DriverRole role) const {
+    return const_cast<Solver*>(this)->entry(role);
+}
+void Solver::solveRole(Role &role) {
+    const std::size_t n = m_grid.size();
+    const double* w = m_grid.omega().data();
+    const double* iw = m_inverseOmega.data();
+
+    double* __restrict ur = role.voltage.real();
+    double* __restrict ui = role.voltage.imag();
+    double* __restrict ir = role.current.real();
+    double* __restrict ii = role.current.imag();
+    double* __restrict br = role.branch.real();
+    double* __restrict bi = role.branch.imag();
+
+    // Start at the driver: U = 1, I = Y_load
+    std::fill(ur, ur + n, 1.0);
+    std::fill(ui, ui + n, 0.0);
+    std::copy(role.loadAdmittance.real(), role.loadAdmittance.real() + n, ir);
+    std::copy(role.loadAdmittance.imag(), role.loadAdmittance.imag() + n, ii);
+
+    const std::vector<Branch> &branches = role.network.branches();
+    for (auto it = branches.rbegin(); it != branches.rend(); ++it) {
+        const Branch &branch = *it;
+        const bool series = branch.placement == Branch::Placement::Series;
+        // A series branch needs its impedance, a shunt branch its admittance.
+        const bool sumImpedances = branch.combination == Branch::Combination::Series;
+
+        std::fill(br, br + n, 0.0);
+        std::fill(bi, bi + n, 0.0);
+        for (const Component &component : branch.components) {
+            if (sumImpedances) {
+                addImpedance(component, w, iw, br, bi, n);
+            } else {
+                addAdmittance(component, w, iw, br, bi, n);
+            }
+        }
+        if (series != sumImpedances) {
+            invert(br, bi, n);
+        }
+
+        if (series) {
+            // U += I * Z
+            for (std::size_t i = 0; i < n; ++i) {
+                ur[i] += ir[i] * br[i] - ii[i] * bi[i];
+                ui[i] += ir[i] * bi[i] + ii[i] * br[i];
+            }
+        } else {
+            // I += U * Y
+            for (std::size_t i = 0; i < n; ++i) {
+                ir[i] += ur[i] * br[i] - ui[i] * bi[i];
+                ii[i] += ur[i] * bi[i] + ui[i] * br[i];
+            }
+        }
+    }
+
+    // H = 1 / U, Z_in = U / I = U * conj(I) / |I|^2
+    double* __restrict hr = role.ladder.real();
+    double* __restrict hi = role.ladder.imag();
+    double* __restrict zr = role.input.real();
+    double* __restrict zi = role.input.imag();
+    for (std::size_t i = 0; i < n; ++i) {
+        const double du = 1.0 / (ur[i] * ur[i] + ui[i] * ui[i]);
+        hr[i] = ur[i] * du;
+        hi[i] = -ui[i] * du;
+        const double di = 1.0 / (ir[i] * ir[i] + ii[i] * ii[i]);
+        zr[i] = (ur[i] * ir[i] + ui[i] * ii[i]) * di;
+        zi[i] = (ui[i] * ir[i] - ur[i] * ii[i]) * di;
+    }
+}
+void Solver::updateSystemImpedance() {
+    const std::size_t n = m_grid.size();
+    double* __restrict yr = m_systemImpedance.real();
+    double* __restrict yi = m_systemImpedance.imag();
+    std::fill(yr, yr + n, 0.0);
+    std::fill(yi, yi + n, 0.0);
+
+    // Y_sys = sum(1 / Z_in)
+    for (const auto &[role, data] : m_roles) {
+        const double* __restrict zr = data.input.real();
+        const double* __restrict zi = data.input.imag();
+        for (std::size_t i = 0; i < n; ++i) {
+            const double d = 1.0 / (zr[i] * zr[i] + zi[i] * zi[i]);
+            yr[i] += zr[i] * d;
+            yi[i] -= zi[i] * d;
+        }
+    }
+
+    // H = H_ladder * D, D = 1 / (1 + Rg * Y_sys)
+    const double rg = m_sourceResistance;
+    for (auto &[role, data] : m_roles) {
+        const double* __restrict lr = data.ladder.real();
+        const double* __restrict li = data.ladder.imag();
+        double* __restrict hr = data.transfer.real();
+        double* __restrict hi = data.transfer.imag();
+        if (rg == 0.0) {
+            std::copy(lr, lr + n, hr);
+            std::copy(li, li + n, hi);
+            continue;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            const double dr = 1.0 + rg * yr[i];
+            const double di = rg * yi[i];
+            const double d = 1.0 / (dr * dr + di * di);
+            hr[i] = (lr[i] * dr + li[i] * di) * d;
+            hi[i] = (li[i] * dr - lr[i] * di) * d;
+        }
+    }
+    invert(yr, yi, n);
+}
+//// end private member methods
+} // namespace SiVAL::Crossover
@@ -0,0 +1,165 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <cmath>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/response/analysis/smoothing.hpp"
+#include <sival/core/exceptions.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+//// end static definitions
+
+namespace SiVAL::Response {
+//// begin static functions
+//// end static functions
+
+//// begin public member methods
+Smoothing::Smoothing(const SiVAL::FrequencyGrid &grid, double fraction)
+    : m_grid(grid),
+    m_fraction(fraction) {
+    if (!(fraction > 0.0)) {
+        throw SiVAL::Exceptions::OutOfRange("The smoothing fraction must be positive.");
+    }
+    const std::vector<double> &f = grid.frequencies();
+    const std::size_t n = f.size();
+    m_lower.resize(n);
+    m_upper.resize(n);
+    m_inverseCount.resize(n);
+
+    // Die Bandgrenzen wachsen monoton mit f_i, daher genügen zwei Zeiger
+    const double factor = std::exp2(0.5 / fraction);
+    std::size_t lower = 0;
+    std::size_t upper = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double low = f[i] / factor;
+        const double high = f[i] * factor;
+        while (lower < i && f[lower] < low) {
+            ++lower;
+        }
+        if (upper <= i) {
+            upper = i + 1;
+        }
+        while (upper < n && f[upper] <= high) {
+            ++upper;
+        }
+        m_lower[i] = lower;
+        m_upper[i] = upper;
+        m_inverseCount[i] = 1.0 / static_cast<double>(upper - lower);
+    }
+}
+Smoothing::~Smoothing() {
+}
+void Smoothing::average(const std::vector<double> &values, std::vector<double> &out) const {
+    check(values.size());
+    std::vector<double> prefix;
+    out.resize(values.size());
+    smooth(values.data(), out.data(), prefix);
+}
+void Smoothing::average(std::vector<double> &values) const {
+    average(values, values);
+}
+void Smoothing::complex(const SiVAL::Spectrum &response, SiVAL::Spectrum &out) const {
+    check(response.size());
+    std::vector<double> prefix;
+    out.resize(response.size());
+    smooth(response.real(), out.real(), prefix);
+    smooth(response.imag(), out.imag(), prefix);
+}
+void Smoothing::complex(SiVAL::Spectrum &response) const {
+    complex(response, response);
+}
+double Smoothing::fraction() const {
+    return m_fraction;
+}
+const SiVAL::FrequencyGrid& Smoothing::grid() const {
+    return m_grid;
+}
+void Smoothing::power(const SiVAL::Spectrum &response, std::vector<double> &magnitude) const {
+    const std::size_t n = response.size();
+    check(n);
+    magnitude.resize(n);
+
+    const double* __restrict re = response.real();
+    const double* __restrict im = response.imag();
+    double* __restrict m = magnitude.data();
+    for (std::size_t i = 0; i < n; ++i) {
+        m[i] = re[i] * re[i] + im[i] * im[i];
+    }
+    std::vector<double> prefix;
+    smooth(m, m, prefix);
+    for (std::size_t i = 0; i < n; ++i) {
+        m[i] = std::sqrt(m[i]);
+    }
+}
+void Smoothing::power(std::vector<double> &magnitude) const {
+    const std::size_t n = magnitude.size();
+    check(n);
+
+    double* __restrict m = magnitude.data();
+    for (std::size_t i = 0; i < n; ++i) {
+        m[i] *= m[i];
+    }
+    std::vector<double> prefix;
+    smooth(m, m, prefix);
+    for (std::size_t i = 0; i < n; ++i) {
+        m[i] = std::sqrt(m[i]);
+    }
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+void Smoothing::check(std::size_t size) const {
+    if (size != m_grid.size()) {
+        throw SiVAL::Exceptions::OutOfRange("The response does not match the grid of the smoothing.");
+    }
+}
+void Smoothing::smooth(const double* values, double* out, std::vector<double> &prefix) const {
+    const std::size_t n = m_grid.size();
+    prefix.resize(n + 1);
+
+    // S_0 = 0, S_k+1 = S_k + x_k; values und out dürfen identisch sein
+    double* s = prefix.data();
+    s[0] = 0.0;
+    for (std::size_t i = 0; i < n; ++i) {
+        s[i + 1] = s[i] + values[i];
+    }
+
+    const std::size_t* __restrict lower = m_lower.data();
+    const std::size_t* __restrict upper = m_upper.data();
+    const double* __restrict inverse = m_inverseCount.data();
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = (s[upper[i]] - s[lower[i]]) * inverse[i];
+    }
+}
+//// end private member methods
+} // namespace SiVAL::Response
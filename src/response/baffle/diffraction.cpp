@@ -0,0 +1,187 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <algorithm>
+#include <cmath>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/response/baffle/diffraction.hpp"
+#include <sival/abstractions/enclosure.hpp>
+#include <sival/core/exceptions.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+/// Adding and subtracting 1.5 * 2^52 rounds a double to the nearest integer.
+static constexpr double kRoundMagic = 6755399441055744.0;
+//// end static definitions
+
+namespace SiVAL::Response {
+//// begin static functions
+/**
+ * @brief Branch-free sine and cosine that the compiler can vectorize.
+ * @details Reduction to \f$ |r| \le \pi/4 \f$ by quarter periods and Taylor polynomials
+ * up to \f$ r^{12} \f$. The absolute error is below \f$ 10^{-11} \f$ for the phases
+ * that occur here (\f$ |x| < 10^6 \f$).
+ */
+static inline void sinCos(double x, double &s, double &c) {
+    const double q = (x * (2.0 / SiVAL::PI) + kRoundMagic) - kRoundMagic;
+    const double r = x - q * (0.5 * SiVAL::PI);
+    const double r2 = r * r;
+    const double sr = r * (1.0 + r2 * (-1.0 / 6.0 + r2 * (1.0 / 120.0 + r2 * (-1.0 / 5040.0
+                      + r2 * (1.0 / 362880.0 + r2 * (-1.0 / 39916800.0))))));
+    const double cr = 1.0 + r2 * (-0.5 + r2 * (1.0 / 24.0 + r2 * (-1.0 / 720.0 + r2 * (1.0 / 40320.0
+                      + r2 * (-1.0 / 3628800.0 + r2 * (1.0 / 479001600.0))))));
+    // Quadrant: sin(r + k pi/2), cos(r + k pi/2)
+    const int k = static_cast<int>(q) & 3;
+    const double sv = (k & 1) ? cr : sr;
+    const double cv = (k & 1) ? sr : cr;
+    s = (k & 2) ? -sv : sv;
+    c = ((k + 1) & 2) ? -cv : cv;
+}
+//// end static functions
+
+//// begin public member methods
+Diffraction::Diffraction(double width, double height, double spacing, double speedOfSound)
+    : m_width(width),
+    m_height(height),
+    m_spacing(spacing),
+    m_speedOfSound(speedOfSound),
+    m_distance(0.0),
+    m_driverX(0.5 * width),
+    m_driverY(0.5 * height) {
+    if (!(width > 0.0) || !(height > 0.0) || !(spacing > 0.0)) {
+        throw SiVAL::Exceptions::OutOfRange("The baffle size and the edge point spacing must be positive.");
+    }
+    // Gegen den Uhrzeigersinn, Normalen zeigen nach außen
+    addEdge(0.0, 0.0, width, 0.0, 0.0, -1.0);
+    addEdge(width, 0.0, width, height, 1.0, 0.0);
+    addEdge(width, height, 0.0, height, 0.0, 1.0);
+    addEdge(0.0, height, 0.0, 0.0, -1.0, 0.0);
+
+    m_amplitude.resize(m_edgeX.size());
+    m_delay.resize(m_edgeX.size());
+    updatePaths();
+}
+Diffraction::Diffraction(const SiVAL::AbstractEnclosure &enclosure, double spacing, double speedOfSound)
+    : Diffraction(enclosure.baffleWidth(), enclosure.baffleHeight(), spacing, speedOfSound) {
+}
+Diffraction::~Diffraction() {
+}
+std::size_t Diffraction::edgePoints() const {
+    return m_edgeX.size();
+}
+void Diffraction::evaluate(const SiVAL::FrequencyGrid &grid, SiVAL::Spectrum &out) const {
+    const std::size_t n = grid.size();
+    out.resize(n);
+
+    const double* __restrict w = grid.omega().data();
+    double* __restrict hr = out.real();
+    double* __restrict hi = out.imag();
+    std::fill(hr, hr + n, 1.0);
+    std::fill(hi, hi + n, 0.0);
+
+    // H = 1 + sum a_k * exp(-j w tau_k)
+    for (std::size_t k = 0; k < m_delay.size(); ++k) {
+        const double a = m_amplitude[k];
+        const double tau = m_delay[k];
+        for (std::size_t i = 0; i < n; ++i) {
+            double s;
+            double c;
+            sinCos(w[i] * tau, s, c);
+            hr[i] += a * c;
+            hi[i] -= a * s;
+        }
+    }
+}
+double Diffraction::height() const {
+    return m_height;
+}
+void Diffraction::setDriver(double x, double y) {
+    if (!(x > 0.0 && x < m_width && y > 0.0 && y < m_height)) {
+        throw SiVAL::Exceptions::OutOfRange("The driver position is not inside of the baffle.");
+    }
+    m_driverX = x;
+    m_driverY = y;
+    updatePaths();
+}
+void Diffraction::setDriver(const SiVAL::AbstractEnclosure &enclosure, SiVAL::DriverRole role) {
+    const SiVAL::BafflePoint position = enclosure.driverPosition(role);
+    setDriver(position.x, position.y);
+}
+void Diffraction::setListenerDistance(double distance) {
+    m_distance = std::max(0.0, distance);
+    updatePaths();
+}
+double Diffraction::width() const {
+    return m_width;
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+void Diffraction::addEdge(double x0, double y0, double x1, double y1, double nx, double ny) {
+    const double length = std::hypot(x1 - x0, y1 - y0);
+    const std::size_t count = static_cast<std::size_t>(std::ceil(length / m_spacing));
+    const double ds = length / static_cast<double>(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        // Mittelpunkt des Segments
+        const double t = (static_cast<double>(i) + 0.5) / static_cast<double>(count);
+        m_edgeX.push_back(x0 + t * (x1 - x0));
+        m_edgeY.push_back(y0 + t * (y1 - y0));
+        m_normalX.push_back(nx);
+        m_normalY.push_back(ny);
+        m_length.push_back(ds);
+    }
+}
+void Diffraction::updatePaths() {
+    const std::size_t count = m_edgeX.size();
+    const double r = m_distance;
+    const double inverseC = 1.0 / m_speedOfSound;
+    const double scale = -0.5 / (2.0 * SiVAL::PI);
+
+    for (std::size_t k = 0; k < count; ++k) {
+        const double dx = m_edgeX[k] - m_driverX;
+        const double dy = m_edgeY[k] - m_driverY;
+        const double d2 = dx * dx + dy * dy;
+        const double d = std::sqrt(d2);
+        const double weight = (m_normalX[k] * dx + m_normalY[k] * dy) * m_length[k] / d2;
+
+        if (r > 0.0) {
+            const double l = std::sqrt(d2 + r * r);
+            m_amplitude[k] = scale * weight * r / l;
+            m_delay[k] = (d + l - r) * inverseC;
+        } else {
+            m_amplitude[k] = scale * weight;
+            m_delay[k] = d * inverseC;
+        }
+    }
+}
+//// end private member methods
+} // namespace SiVAL::Response
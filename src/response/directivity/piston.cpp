@@ -0,0 +1,121 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <algorithm>
+#include <cmath>
+#include <vector>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/response/directivity/piston.hpp"
+#include <sival/libsival.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+/// Number of table entries per unit of x.
+static constexpr double kTableResolution = 32.0;
+/// The largest x that is covered by the table.
+static constexpr double kTableLimit = 256.0;
+/// Number of table intervals.
+static constexpr std::size_t kTableIntervals = static_cast<std::size_t>(kTableLimit * kTableResolution);
+//// end static definitions
+
+namespace SiVAL::Response {
+//// begin static functions
+/**
+ * @brief 2 J1(x) / x calculated directly (slow).
+ */
+static double exactDirectivity(double x) {
+    if (x < 1e-8) {
+        return 1.0;
+    }
+    if (x > kTableLimit) {
+        // Asymptotische Entwicklung für große Argumente
+        const double j1 = std::sqrt(2.0 / (SiVAL::PI * x)) * std::cos(x - 0.75 * SiVAL::PI);
+        return 2.0 * j1 / x;
+    }
+    return 2.0 * std::cyl_bessel_j(1.0, x) / x;
+}
+
+/**
+ * @brief Returns the cached table. It is built once on first use (thread-safe static initialization).
+ * @details The table has one additional entry, so the interpolation never reads past its end.
+ */
+static const std::vector<double>& table() {
+    static const std::vector<double> values = [] {
+        std::vector<double> v(kTableIntervals + 2);
+        for (std::size_t i = 0; i < v.size(); ++i) {
+            v[i] = exactDirectivity(static_cast<double>(i) / kTableResolution);
+        }
+        return v;
+    }();
+    return values;
+}
+//// end static functions
+
+//// begin public member methods
+double Piston::directivity(double x) {
+    x = std::abs(x);
+    if (x >= kTableLimit) {
+        return exactDirectivity(x);
+    }
+    const double t = x * kTableResolution;
+    const std::size_t k = static_cast<std::size_t>(t);
+    const double* values = table().data();
+    return values[k] + (t - static_cast<double>(k)) * (values[k + 1] - values[k]);
+}
+void Piston::directivity(const double* ka, double sine, double* out, std::size_t n) {
+    const double* __restrict values = table().data();
+    const double* __restrict in = ka;
+    double* __restrict result = out;
+    const double s = std::abs(sine) * kTableResolution;
+    const double limit = kTableLimit * kTableResolution;
+
+    // Lineare Interpolation ohne Verzweigung, damit die Schleife vektorisiert werden kann.
+    bool outside = false;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double t = std::min(in[i] * s, limit);
+        const std::size_t k = static_cast<std::size_t>(t);
+        result[i] = values[k] + (t - static_cast<double>(k)) * (values[k + 1] - values[k]);
+        outside |= t >= limit;
+    }
+    if (outside) {
+        for (std::size_t i = 0; i < n; ++i) {
+            if (in[i] * s >= limit) {
+                result[i] = exactDirectivity(in[i] * std::abs(sine));
+            }
+        }
+    }
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+//// end private member methods
+} // namespace SiVAL::Response
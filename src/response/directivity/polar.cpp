@@ -0,0 +1,151 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <algorithm>
+#include <cmath>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/response/directivity/polar.hpp"
+#include <sival/abstractions/driver.hpp>
+#include <sival/core/exceptions.hpp>
+#include <sival/response/directivity/piston.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+//// end static definitions
+
+namespace SiVAL::Response {
+//// begin static functions
+/**
+ * @brief Returns the piston radius of a driver in meters.
+ */
+static double pistonRadius(const SiVAL::AbstractDriver &driver) {
+    if (driver.effectiveDiameter() > 0.0) {
+        return 0.5 * driver.effectiveDiameter();
+    }
+    return std::sqrt(driver.sd() / SiVAL::PI);
+}
+//// end static functions
+
+//// begin public member methods
+PolarResponse::PolarResponse(double radius, double speedOfSound)
+    : m_radius(radius), m_speedOfSound(speedOfSound) {
+    if (!(radius > 0.0)) {
+        throw SiVAL::Exceptions::OutOfRange("The piston radius must be positive.");
+    }
+}
+PolarResponse::PolarResponse(const SiVAL::AbstractDriver &driver, double speedOfSound)
+    : PolarResponse(pistonRadius(driver), speedOfSound) {
+}
+PolarResponse::~PolarResponse() {
+}
+std::vector<double> PolarResponse::equalAngles(std::size_t count) {
+    std::vector<double> angles(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        angles[i] = 360.0 * static_cast<double>(i) / static_cast<double>(count);
+    }
+    return angles;
+}
+const std::vector<double>& PolarResponse::angles() const {
+    return m_angles;
+}
+void PolarResponse::apply(std::size_t angle, const SiVAL::Spectrum &onAxis, SiVAL::Spectrum &out) const {
+    const std::size_t n = m_grid.size();
+    if (onAxis.size() != n) {
+        throw SiVAL::Exceptions::OutOfRange("The on-axis pressure does not match the grid of the polar response.");
+    }
+    const double* __restrict d = row(angle);
+    out.resize(n);
+    const double* __restrict pr = onAxis.real();
+    const double* __restrict pi = onAxis.imag();
+    double* __restrict qr = out.real();
+    double* __restrict qi = out.imag();
+    for (std::size_t i = 0; i < n; ++i) {
+        qr[i] = pr[i] * d[i];
+        qi[i] = pi[i] * d[i];
+    }
+}
+double PolarResponse::at(std::size_t angle, std::size_t frequency) const {
+    if (frequency >= m_grid.size()) {
+        throw SiVAL::Exceptions::OutOfRange("The frequency index is out of range.");
+    }
+    return row(angle)[frequency];
+}
+void PolarResponse::evaluate(const SiVAL::FrequencyGrid &grid, const std::vector<double> &angles) {
+    m_grid = grid;
+    m_angles = angles;
+    const std::size_t n = grid.size();
+    m_values.assign(angles.size() * n, 0.0);
+
+    // ka einmal pro Frequenz
+    std::vector<double> ka(n);
+    const double scale = m_radius / m_speedOfSound;
+    for (std::size_t i = 0; i < n; ++i) {
+        ka[i] = grid.omega()[i] * scale;
+    }
+
+    for (std::size_t a = 0; a < angles.size(); ++a) {
+        const double theta = angles[a] * SiVAL::PI / 180.0;
+        // Behind the baffle: the row stays 0
+        if (std::cos(theta) < -1e-12) {
+            continue;
+        }
+        Piston::directivity(ka.data(), std::sin(theta), m_values.data() + a * n, n);
+    }
+}
+const SiVAL::FrequencyGrid& PolarResponse::grid() const {
+    return m_grid;
+}
+std::vector<double> PolarResponse::levelDb(std::size_t angle) const {
+    const double* d = row(angle);
+    std::vector<double> level(m_grid.size());
+    for (std::size_t i = 0; i < level.size(); ++i) {
+        level[i] = std::max(-200.0, 20.0 * std::log10(std::abs(d[i])));
+    }
+    return level;
+}
+double PolarResponse::radius() const {
+    return m_radius;
+}
+const double* PolarResponse::row(std::size_t angle) const {
+    if (angle >= m_angles.size()) {
+        throw SiVAL::Exceptions::OutOfRange("The angle index is out of range.");
+    }
+    return m_values.data() + angle * m_grid.size();
+}
+const std::vector<double>& PolarResponse::values() const {
+    return m_values;
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+//// end private member methods
+} // namespace SiVAL::Response
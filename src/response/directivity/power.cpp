@@ -0,0 +1,171 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <algorithm>
+#include <cmath>
+#include <utility>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/response/directivity/power.hpp"
+#include <sival/core/exceptions.hpp>
+#include <sival/response/directivity/polar.hpp>
+#include <sival/utils/parallel.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+/// Number of frequencies of one band of the parallel reduction.
+static constexpr std::size_t kBandSize = 64;
+//// end static definitions
+
+namespace SiVAL::Response {
+//// begin static functions
+//// end static functions
+
+//// begin public member methods
+PowerResponse::PowerResponse(const PolarResponse &polar)
+    : m_polar(polar), m_axis(0) {
+    const std::vector<double> &angles = polar.angles();
+    m_weights.assign(angles.size(), 0.0);
+
+    // Winkel in [0°, 180°] sortieren, Duplikate (z.B. 0° und 360°) nur einmal verwenden
+    std::vector<std::pair<double, std::size_t>> used;
+    for (std::size_t j = 0; j < angles.size(); ++j) {
+        double angle = std::fmod(angles[j], 360.0);
+        if (angle < 0.0) {
+            angle += 360.0;
+        }
+        if (angle > 180.0 + 1e-9) {
+            continue;
+        }
+        used.emplace_back(std::min(angle, 180.0) * SiVAL::PI / 180.0, j);
+    }
+    std::sort(used.begin(), used.end());
+    used.erase(std::unique(used.begin(), used.end(), [](const auto &a, const auto &b) {
+        return std::abs(a.first - b.first) < 1e-12;
+    }), used.end());
+
+    if (used.size() < 2 || used.front().first > 1e-9 || used.back().first < SiVAL::PI - 1e-9) {
+        throw SiVAL::Exceptions::OutOfRange("The polar response must contain the angles 0° and 180°.");
+    }
+    m_axis = used.front().second;
+
+    // Exakte Gewichte für stückweise lineares D² auf [a, b]:
+    // I0 = int sin = cos a - cos b, I1 = int theta sin = [sin - theta cos]_a^b
+    for (std::size_t k = 0; k + 1 < used.size(); ++k) {
+        const double a = used[k].first;
+        const double b = used[k + 1].first;
+        const double i0 = std::cos(a) - std::cos(b);
+        const double i1 = (std::sin(b) - b * std::cos(b)) - (std::sin(a) - a * std::cos(a));
+        m_weights[used[k].second] += (b * i0 - i1) / (b - a);
+        m_weights[used[k + 1].second] += (i1 - a * i0) / (b - a);
+    }
+}
+PowerResponse::~PowerResponse() {
+}
+const std::vector<double>& PowerResponse::average() const {
+    return m_average;
+}
+const std::vector<double>& PowerResponse::directivityIndex() const {
+    return m_directivityIndex;
+}
+void PowerResponse::evaluate(std::size_t threads) {
+    if (m_polar.angles().size() != m_weights.size()) {
+        throw SiVAL::Exceptions::OutOfRange("The polar response was evaluated with different angles.");
+    }
+    const std::size_t n = m_polar.grid().size();
+    const std::size_t rows = m_weights.size();
+    m_average.assign(n, 0.0);
+    m_directivityIndex.assign(n, 0.0);
+
+    const double* values = m_polar.values().data();
+    const double* weights = m_weights.data();
+    double* average = m_average.data();
+    double* index = m_directivityIndex.data();
+    const double* axis = values + m_axis * n;
+
+    const std::size_t bands = (n + kBandSize - 1) / kBandSize;
+    SiVAL::Utils::parallelFor(bands, [&](std::size_t band, std::size_t) {
+        const std::size_t begin = band * kBandSize;
+        const std::size_t end = std::min(n, begin + kBandSize);
+        double* __restrict sum = average;
+
+        for (std::size_t j = 0; j < rows; ++j) {
+            const double w = 0.5 * weights[j];
+            if (w == 0.0) {
+                continue;
+            }
+            const double* __restrict d = values + j * n;
+            for (std::size_t i = begin; i < end; ++i) {
+                sum[i] += w * d[i] * d[i];
+            }
+        }
+        for (std::size_t i = begin; i < end; ++i) {
+            index[i] = 10.0 * std::log10(axis[i] * axis[i] / sum[i]);
+        }
+    }, threads);
+}
+std::vector<double> PowerResponse::powerSpl(const SiVAL::Spectrum &onAxis) const {
+    const std::size_t n = m_average.size();
+    if (onAxis.size() != n) {
+        throw SiVAL::Exceptions::OutOfRange("The on-axis pressure does not match the power response.");
+    }
+    const double ref2 = SiVAL::P_REF * SiVAL::P_REF;
+    const double* pr = onAxis.real();
+    const double* pi = onAxis.imag();
+    std::vector<double> spl(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        spl[i] = 10.0 * std::log10((pr[i] * pr[i] + pi[i] * pi[i]) * m_average[i] / ref2);
+    }
+    return spl;
+}
+std::vector<double> PowerResponse::soundPower(const SiVAL::Spectrum &onAxis, double distance,
+                                              double densityOfAir, double speedOfSound) const {
+    const std::size_t n = m_average.size();
+    if (onAxis.size() != n) {
+        throw SiVAL::Exceptions::OutOfRange("The on-axis pressure does not match the power response.");
+    }
+    const double scale = 4.0 * SiVAL::PI * distance * distance / (densityOfAir * speedOfSound);
+    const double* pr = onAxis.real();
+    const double* pi = onAxis.imag();
+    std::vector<double> power(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        power[i] = scale * (pr[i] * pr[i] + pi[i] * pi[i]) * m_average[i];
+    }
+    return power;
+}
+const std::vector<double>& PowerResponse::weights() const {
+    return m_weights;
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+//// end private member methods
+} // namespace SiVAL::Response
@@ -0,0 +1,213 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <charconv>
+#include <cmath>
+#include <utility>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/response/measurement/measurement.hpp"
+#include <sival/core/exceptions.hpp>
+#include <sival/utils/mappedfile.hpp>
+#include <sival/utils/parallel.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+/// Typical size of one data line, used to reserve the point arrays.
+static constexpr std::size_t kBytesPerLine = 32;
+//// end static definitions
+
+namespace SiVAL::Response {
+//// begin static functions
+static inline bool isBlank(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+static inline bool isSeparator(char c) {
+    return c == ' ' || c == '\t' || c == ',' || c == ';';
+}
+/**
+ * @brief Returns the type of a measurement file by its extension (.frd or .zma, any case).
+ */
+static SiVAL::ResponseType typeOfPath(const std::string &path) {
+    const std::size_t dot = path.find_last_of('.');
+    if (dot != std::string::npos && path.size() - dot == 4) {
+        char extension[3];
+        for (std::size_t i = 0; i < 3; ++i) {
+            const char c = path[dot + 1 + i];
+            extension[i] = (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+        }
+        if (extension[0] == 'f' && extension[1] == 'r' && extension[2] == 'd') {
+            return SiVAL::ResponseType::Spl;
+        }
+        if (extension[0] == 'z' && extension[1] == 'm' && extension[2] == 'a') {
+            return SiVAL::ResponseType::Impedance;
+        }
+    }
+    throw SiVAL::Exceptions::OutOfRange("Unknown measurement file type (expected .frd or .zma): " + path);
+}
+//// end static functions
+
+//// begin public member methods
+Measurement::Measurement()
+    : m_type(SiVAL::ResponseType::Spl) {
+}
+Measurement::Measurement(SiVAL::ResponseType type, std::vector<double> frequencies, std::vector<double> magnitude,
+                         std::vector<double> phase)
+    : m_type(type),
+    m_grid(std::move(frequencies)),
+    m_magnitude(std::move(magnitude)),
+    m_phase(std::move(phase)) {
+    if (m_magnitude.size() != m_grid.size() || m_phase.size() != m_grid.size()) {
+        throw SiVAL::Exceptions::OutOfRange("The frequencies, magnitudes and phases of a measurement differ in size.");
+    }
+}
+Measurement::~Measurement() {
+}
+const SiVAL::FrequencyGrid& Measurement::grid() const {
+    return m_grid;
+}
+Measurement Measurement::load(const std::string &path) {
+    return load(path, typeOfPath(path));
+}
+Measurement Measurement::load(const std::string &path, SiVAL::ResponseType type) {
+    const SiVAL::Utils::MappedFile file(path);
+    try {
+        return parse(file.begin(), file.end(), type);
+    } catch (const SiVAL::Exceptions::OutOfRange &e) {
+        throw SiVAL::Exceptions::OutOfRange(e.errorMsg() + " (" + path + ")");
+    }
+}
+std::vector<Measurement> Measurement::load(const std::vector<std::string> &paths, std::size_t threads) {
+    std::vector<Measurement> measurements(paths.size());
+    SiVAL::Utils::parallelFor(paths.size(), [&](std::size_t index, std::size_t) {
+        measurements[index] = load(paths[index]);
+    }, threads);
+    return measurements;
+}
+const std::vector<double>& Measurement::magnitude() const {
+    return m_magnitude;
+}
+Measurement Measurement::parse(const char* begin, const char* end, SiVAL::ResponseType type) {
+    std::vector<double> frequencies;
+    std::vector<double> magnitude;
+    std::vector<double> phase;
+    const std::size_t expected = static_cast<std::size_t>(end - begin) / kBytesPerLine + 1;
+    frequencies.reserve(expected);
+    magnitude.reserve(expected);
+    phase.reserve(expected);
+
+    const char* p = begin;
+    while (p < end) {
+        while (p < end && isBlank(*p)) {
+            ++p;
+        }
+        // Bis zu drei Zahlen je Zeile: f, Betrag, Phase
+        double values[3] = {0.0, 0.0, 0.0};
+        int count = 0;
+        while (count < 3 && p < end && *p != '\n') {
+            if (*p == '+') {
+                ++p;
+            }
+            const std::from_chars_result result = std::from_chars(p, end, values[count]);
+            if (result.ec != std::errc()) {
+                break;
+            }
+            ++count;
+            p = result.ptr;
+            while (p < end && (isSeparator(*p) || *p == '\r')) {
+                ++p;
+            }
+        }
+        // Rest der Zeile (Kommentar, Text, weitere Spalten) überspringen
+        while (p < end && *p != '\n') {
+            ++p;
+        }
+        if (p < end) {
+            ++p;
+        }
+
+        if (count >= 2 && values[0] > 0.0 && (frequencies.empty() || values[0] > frequencies.back())) {
+            frequencies.push_back(values[0]);
+            magnitude.push_back(values[1]);
+            phase.push_back(values[2]);
+        }
+    }
+    if (frequencies.size() < 2) {
+        throw SiVAL::Exceptions::OutOfRange("The measurement contains fewer than two data points.");
+    }
+    return Measurement(type, std::move(frequencies), std::move(magnitude), std::move(phase));
+}
+const std::vector<double>& Measurement::phase() const {
+    return m_phase;
+}
+void Measurement::resample(const SiVAL::FrequencyGrid &grid, SiVAL::Spectrum &out,
+                           SiVAL::Resampler::Method method) const {
+    if (m_grid.empty()) {
+        throw SiVAL::Exceptions::OutOfRange("The measurement is empty.");
+    }
+    resample(SiVAL::Resampler(m_grid, grid, method), out);
+}
+void Measurement::resample(const SiVAL::Resampler &resampler, SiVAL::Spectrum &out) const {
+    if (!(resampler.source() == m_grid)) {
+        throw SiVAL::Exceptions::OutOfRange("The resampler does not start from the grid of the measurement.");
+    }
+    const std::size_t points = m_phase.size();
+    const double toRadian = SiVAL::PI / 180.0;
+    std::vector<double> phase(points);
+    for (std::size_t k = 0; k < points; ++k) {
+        phase[k] = m_phase[k] * toRadian;
+    }
+    std::vector<double> level;
+    std::vector<double> angle;
+    resampler.applyPolar(m_magnitude, phase, level, angle);
+
+    const std::size_t n = level.size();
+    out.resize(n);
+    double* __restrict re = out.real();
+    double* __restrict im = out.imag();
+    const bool spl = m_type != SiVAL::ResponseType::Impedance;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double value = spl ? SiVAL::P_REF * std::pow(10.0, level[i] / 20.0) : level[i];
+        re[i] = value * std::cos(angle[i]);
+        im[i] = value * std::sin(angle[i]);
+    }
+}
+std::size_t Measurement::size() const {
+    return m_grid.size();
+}
+SiVAL::ResponseType Measurement::type() const {
+    return m_type;
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+//// end private member methods
+} // namespace SiVAL::Response
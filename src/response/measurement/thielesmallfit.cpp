@@ -0,0 +1,540 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <algorithm>
+#include <cmath>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/response/measurement/thielesmallfit.hpp"
+#include <sival/components/driver/lowdriver.hpp>
+#include <sival/core/exceptions.hpp>
+#include <sival/utils/parallel.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+/// Number of motional parameters: Re, fs, Qms, Qes. The voice coil parameters follow.
+static constexpr std::size_t kMotional = 4;
+/// Largest number of fitted parameters (Wright model).
+static constexpr std::size_t kMaxParameters = 8;
+/// Smallest voice coil inductance in H, keeps log(Le) finite for curves without inductive rise.
+static constexpr double kMinInductance = 1e-9;
+/// Smallest number of measured points in the band.
+static constexpr std::size_t kMinPoints = 5;
+//// end static definitions
+
+namespace SiVAL::Response {
+//// begin static functions
+/**
+ * @brief The measured points of the fitted band.
+ */
+struct Points {
+    const double* omega;
+    const double* real;
+    const double* imag;
+    const double* magnitude;
+    const double* inverse;
+    std::size_t size;
+};
+/**
+ * @brief Calculates the cost (sum of squared relative residuals) and optionally the normal equations.
+ * @param p The parameters Re, fs, Qms, Qes followed by the parameters of `coil`.
+ * @param coil The voice coil model, its parameters are replaced by those of `p`.
+ * @param jtj Receives \f$ J^T J \f$ for logarithmic parameters, or `nullptr`.
+ * @param jtr Receives \f$ J^T r \f$, or `nullptr`.
+ */
+static double accumulate(const Points &points, const double* p, SiVAL::VoiceCoil coil, bool usePhase,
+                         double jtj[kMaxParameters][kMaxParameters], double* jtr) {
+    const std::size_t count = kMotional + coil.parameterCount();
+    coil.setParameters(p + kMotional);
+    const double re = p[0];
+    const double ws = 2.0 * SiVAL::PI * p[1];
+    const double qms = p[2];
+    const double r = re * qms / p[3];
+    if (jtj != nullptr) {
+        for (std::size_t a = 0; a < count; ++a) {
+            jtr[a] = 0.0;
+            for (std::size_t b = 0; b < count; ++b) {
+                jtj[a][b] = 0.0;
+            }
+        }
+    }
+
+    double cost = 0.0;
+    for (std::size_t i = 0; i < points.size; ++i) {
+        const double w = points.omega[i];
+        const double x = w / ws - ws / w;
+        // 1 / D = (1 - j Qms x) / (1 + Qms^2 x^2)
+        const double a = 1.0 / (1.0 + qms * qms * x * x);
+        const double dr = a;
+        const double di = -qms * x * a;
+        const double mr = r * dr;
+        const double mi = r * di;
+
+        double gr[kMaxParameters];
+        double gi[kMaxParameters];
+        double vr;
+        double vi;
+        coil.derivatives(w, vr, vi, gr + kMotional, gi + kMotional);
+        const double modelReal = re + vr + mr;
+        const double modelImag = vi + mi;
+
+        double residual[2];
+        std::size_t rows;
+        if (usePhase) {
+            residual[0] = (modelReal - points.real[i]) * points.inverse[i];
+            residual[1] = (modelImag - points.imag[i]) * points.inverse[i];
+            rows = 2;
+        } else {
+            residual[0] = (std::hypot(modelReal, modelImag) - points.magnitude[i]) * points.inverse[i];
+            rows = 1;
+        }
+        for (std::size_t k = 0; k < rows; ++k) {
+            cost += residual[k] * residual[k];
+        }
+        if (jtj == nullptr) {
+            continue;
+        }
+
+        // p * dZ/dp für die Parameter der Bewegungsimpedanz
+        const double y = w / ws + ws / w;
+        const double tr = mr * dr - mi * di;     // Zm / D
+        const double ti = mr * di + mi * dr;
+        gr[0] = re + mr;
+        gi[0] = mi;
+        gr[1] = -ti * qms * y;                   // Zm / D * j Qms y
+        gi[1] = tr * qms * y;
+        gr[2] = tr;
+        gi[2] = ti;
+        gr[3] = -mr;
+        gi[3] = -mi;
+
+        double jacobian[2][kMaxParameters];
+        if (usePhase) {
+            for (std::size_t k = 0; k < count; ++k) {
+                jacobian[0][k] = gr[k] * points.inverse[i];
+                jacobian[1][k] = gi[k] * points.inverse[i];
+            }
+        } else {
+            // d|Z| = Re(conj(Z) dZ) / |Z|
+            const double scale = points.inverse[i] / std::hypot(modelReal, modelImag);
+            for (std::size_t k = 0; k < count; ++k) {
+                jacobian[0][k] = (modelReal * gr[k] + modelImag * gi[k]) * scale;
+            }
+        }
+        for (std::size_t row = 0; row < rows; ++row) {
+            for (std::size_t a = 0; a < count; ++a) {
+                jtr[a] += jacobian[row][a] * residual[row];
+                for (std::size_t b = 0; b <= a; ++b) {
+                    jtj[a][b] += jacobian[row][a] * jacobian[row][b];
+                }
+            }
+        }
+    }
+    if (jtj != nullptr) {
+        for (std::size_t a = 0; a < count; ++a) {
+            for (std::size_t b = a + 1; b < count; ++b) {
+                jtj[a][b] = jtj[b][a];
+            }
+        }
+    }
+    return cost;
+}
+/**
+ * @brief Solves the symmetric positive definite system A x = b of size `count` by Cholesky decomposition.
+ * @return False if A is not positive definite.
+ */
+static bool solve(double a[kMaxParameters][kMaxParameters], const double* b, double* x, std::size_t count) {
+    double l[kMaxParameters][kMaxParameters] = {};
+    for (std::size_t i = 0; i < count; ++i) {
+        for (std::size_t j = 0; j <= i; ++j) {
+            double sum = a[i][j];
+            for (std::size_t k = 0; k < j; ++k) {
+                sum -= l[i][k] * l[j][k];
+            }
+            if (i == j) {
+                if (!(sum > 0.0)) {
+                    return false;
+                }
+                l[i][i] = std::sqrt(sum);
+            } else {
+                l[i][j] = sum / l[j][j];
+            }
+        }
+    }
+    double y[kMaxParameters];
+    for (std::size_t i = 0; i < count; ++i) {
+        double sum = b[i];
+        for (std::size_t k = 0; k < i; ++k) {
+            sum -= l[i][k] * y[k];
+        }
+        y[i] = sum / l[i][i];
+    }
+    for (std::size_t i = count; i-- > 0;) {
+        double sum = y[i];
+        for (std::size_t k = i + 1; k < count; ++k) {
+            sum -= l[k][i] * x[k];
+        }
+        x[i] = sum / l[i][i];
+    }
+    return true;
+}
+/**
+ * @brief Levenberg-Marquardt search in logarithmic coordinates.
+ * @param p The start values, receives the result (Re, fs, Qms, Qes, voice coil parameters).
+ * @param coil The voice coil model, receives the fitted parameters.
+ * @return The final cost.
+ */
+static double levenbergMarquardt(const Points &points, double* p, SiVAL::VoiceCoil &coil,
+                                 const ThieleSmallFit::Settings &settings, ThieleSmallFit::Result &result) {
+    const std::size_t count = kMotional + coil.parameterCount();
+    // Le (Simple, LR2) darf gegen 0 gehen, bleibt aber logarithmisch darstellbar
+    const bool inductance = coil.model == SiVAL::VoiceCoil::Model::Simple || coil.model == SiVAL::VoiceCoil::Model::LR2;
+    double q[kMaxParameters];
+    for (std::size_t k = 0; k < count; ++k) {
+        q[k] = std::log(p[k]);
+    }
+    double jtj[kMaxParameters][kMaxParameters];
+    double jtr[kMaxParameters];
+    double cost = accumulate(points, p, coil, settings.usePhase, jtj, jtr);
+
+    double lambda = 1e-3;
+    for (std::size_t iteration = 0; iteration < settings.iterations; ++iteration) {
+        ++result.iterations;
+        bool accepted = false;
+        double improvement = 0.0;
+        for (int attempt = 0; attempt < 30 && !accepted; ++attempt) {
+            double a[kMaxParameters][kMaxParameters];
+            double b[kMaxParameters];
+            double step[kMaxParameters];
+            for (std::size_t i = 0; i < count; ++i) {
+                for (std::size_t j = 0; j < count; ++j) {
+                    a[i][j] = jtj[i][j];
+                }
+                a[i][i] += lambda * jtj[i][i] + 1e-15;
+                b[i] = -jtr[i];
+            }
+            if (!solve(a, b, step, count)) {
+                lambda *= 4.0;
+                continue;
+            }
+            double qn[kMaxParameters] = {};
+            double pn[kMaxParameters] = {};
+            for (std::size_t k = 0; k < count; ++k) {
+                qn[k] = q[k] + step[k];
+            }
+            if (inductance) {
+                qn[kMotional] = std::max(qn[kMotional], std::log(kMinInductance));
+            }
+            for (std::size_t k = 0; k < count; ++k) {
+                pn[k] = std::exp(qn[k]);
+            }
+            const double trial = accumulate(points, pn, coil, settings.usePhase, nullptr, nullptr);
+            if (trial < cost) {
+                improvement = (cost - trial) / cost;
+                std::copy(qn, qn + count, q);
+                std::copy(pn, pn + count, p);
+                cost = accumulate(points, p, coil, settings.usePhase, jtj, jtr);
+                lambda = std::max(lambda / 3.0, 1e-12);
+                accepted = true;
+            } else {
+                lambda *= 4.0;
+            }
+        }
+        // Kein Schritt verbessert mehr: lokales Minimum erreicht
+        if (!accepted || improvement < settings.tolerance) {
+            result.converged = true;
+            break;
+        }
+    }
+    coil.setParameters(p + kMotional);
+    return cost;
+}
+/**
+ * @brief Derives Cms, Vas, Bl and Rms from a known moving mass.
+ */
+static void complete(ThieleSmallFit::Result &result, double mms, double sd) {
+    const double ws = 2.0 * SiVAL::PI * result.fs;
+    result.mms = mms;
+    result.cms = 1.0 / (ws * ws * mms);
+    result.vas = SiVAL::RHO0 * SiVAL::C_SOUND * SiVAL::C_SOUND * sd * sd * result.cms.value();
+    result.bl = std::sqrt(ws * mms * result.re / result.qes);
+    result.rms = ws * mms / result.qms;
+}
+//// end static functions
+
+/**
+ * @brief The measured points of the band, allocated once per thread.
+ */
+struct ThieleSmallFit::Workspace {
+    std::vector<double> omega;
+    std::vector<double> real;
+    std::vector<double> imag;
+    std::vector<double> magnitude;
+    std::vector<double> inverse;
+};
+
+//// begin public member methods
+ThieleSmallFit::ThieleSmallFit() {
+}
+ThieleSmallFit::~ThieleSmallFit() {
+}
+void ThieleSmallFit::addedMass(Result &free, const Result &loaded, double mass, double sd) {
+    if (!(mass > 0.0) || !(sd > 0.0) || !(loaded.fs > 0.0) || !(loaded.fs < free.fs)) {
+        throw SiVAL::Exceptions::OutOfRange("The added mass must lower the resonance; mass and area must be positive.");
+    }
+    const double ratio = free.fs / loaded.fs;
+    complete(free, mass / (ratio * ratio - 1.0), sd);
+}
+ThieleSmallFit::Result ThieleSmallFit::fit(const Measurement &impedance) const {
+    return fit(impedance, Settings());
+}
+ThieleSmallFit::Result ThieleSmallFit::fit(const Measurement &impedance, const Settings &settings) const {
+    Workspace workspace;
+    return fit(workspace, impedance, settings);
+}
+std::vector<ThieleSmallFit::Result> ThieleSmallFit::fit(const std::vector<Measurement> &impedances,
+                                                        const Settings &settings) const {
+    std::vector<Result> results(impedances.size());
+    std::vector<Workspace> workspaces(SiVAL::Utils::threadCount(settings.threads, impedances.size()));
+    SiVAL::Utils::parallelFor(impedances.size(), [&](std::size_t index, std::size_t worker) {
+        results[index] = fit(workspaces[worker], impedances[index], settings);
+    }, settings.threads);
+    return results;
+}
+void ThieleSmallFit::knownVolume(Result &free, const Result &boxed, double volume, double sd) {
+    if (!(volume > 0.0) || !(sd > 0.0) || !(boxed.fs > free.fs)) {
+        throw SiVAL::Exceptions::OutOfRange("The box must raise the resonance; volume and area must be positive.");
+    }
+    const double vas = volume * (boxed.fs * boxed.qes / (free.fs * free.qes) - 1.0);
+    if (!(vas > 0.0)) {
+        throw SiVAL::Exceptions::OutOfRange("The closed box measurement gives no positive Vas.");
+    }
+    const double cms = vas / (SiVAL::RHO0 * SiVAL::C_SOUND * SiVAL::C_SOUND * sd * sd);
+    const double ws = 2.0 * SiVAL::PI * free.fs;
+    complete(free, 1.0 / (ws * ws * cms), sd);
+}
+std::shared_ptr<SiVAL::AbstractDriver> ThieleSmallFit::toDriver(const Result &result, const nlohmann::json &reference) {
+    nlohmann::json data = reference;
+    auto quantity = [](double value, const char* unit) {
+        return nlohmann::json{{"value", value}, {"unit", unit}};
+    };
+
+    nlohmann::json &ep = data.at("electrical_parameters");
+    ep["re"] = quantity(result.re, "Ohm");
+    ep["le"] = quantity(result.le, "H");
+    if (result.bl.has_value()) {
+        ep["bl"] = quantity(result.bl.value(), "Tm");
+    }
+    ep.erase("sensitivity");
+    const SiVAL::VoiceCoil &coil = result.voiceCoil;
+    switch (coil.model) {
+    case SiVAL::VoiceCoil::Model::Simple:
+        ep.erase("voice_coil");
+        break;
+    case SiVAL::VoiceCoil::Model::LR2:
+        ep["voice_coil"] = {{"model", "LR2"}, {"r2", quantity(coil.r2, "Ohm")}, {"l2", quantity(coil.l2, "H")}};
+        break;
+    case SiVAL::VoiceCoil::Model::Wright:
+        ep["voice_coil"] = {{"model", "Wright"}, {"krm", quantity(coil.krm, "")}, {"erm", quantity(coil.erm, "")},
+                            {"kxm", quantity(coil.kxm, "")}, {"exm", quantity(coil.exm, "")}};
+        break;
+    case SiVAL::VoiceCoil::Model::Leach:
+        ep["voice_coil"] = {{"model", "Leach"}, {"k", quantity(coil.k, "")}, {"n", quantity(coil.n, "")}};
+        break;
+    }
+
+    nlohmann::json &tsp = data.at("thiele_small_parameters");
+    tsp["fs"] = quantity(result.fs, "Hz");
+    tsp["qms"] = quantity(result.qms, "");
+    tsp["qes"] = quantity(result.qes, "");
+    if (result.mms.has_value()) {
+        tsp["mms"] = quantity(result.mms.value(), "kg");
+    }
+    if (result.rms.has_value()) {
+        tsp["rms"] = quantity(result.rms.value(), "Ns_m");
+    }
+    // Werden vom Treiber aus den neuen Werten berechnet
+    tsp.erase("qts");
+    tsp.erase("cms");
+    tsp.erase("stiffness");
+    tsp.erase("vas");
+
+    return std::make_shared<SiVAL::Driver::LowDriver>(data);
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+ThieleSmallFit::Result ThieleSmallFit::fit(Workspace &workspace, const Measurement &impedance,
+                                           const Settings &settings) const {
+    if (impedance.type() != SiVAL::ResponseType::Impedance) {
+        throw SiVAL::Exceptions::OutOfRange("The Thiele-Small fit needs an impedance measurement.");
+    }
+    const std::vector<double> &f = impedance.grid().frequencies();
+    const std::vector<double> &magnitude = impedance.magnitude();
+    const std::vector<double> &phase = impedance.phase();
+
+    workspace.omega.clear();
+    workspace.real.clear();
+    workspace.imag.clear();
+    workspace.magnitude.clear();
+    workspace.inverse.clear();
+    for (std::size_t i = 0; i < f.size(); ++i) {
+        if (f[i] < settings.minFrequency || f[i] > settings.maxFrequency || !(magnitude[i] > 0.0)) {
+            continue;
+        }
+        const double angle = phase[i] * SiVAL::PI / 180.0;
+        workspace.omega.push_back(2.0 * SiVAL::PI * f[i]);
+        workspace.real.push_back(magnitude[i] * std::cos(angle));
+        workspace.imag.push_back(magnitude[i] * std::sin(angle));
+        workspace.magnitude.push_back(magnitude[i]);
+        workspace.inverse.push_back(1.0 / magnitude[i]);
+    }
+    const std::size_t n = workspace.omega.size();
+    if (n < kMinPoints) {
+        throw SiVAL::Exceptions::OutOfRange("The impedance has too few points in the fitted band.");
+    }
+    const double* w = workspace.omega.data();
+    const double* zm = workspace.magnitude.data();
+
+    // --- Startwerte aus der Kurve ---
+    // Resonanz: das lokale Maximum, das innerhalb einer Oktave nach beiden Seiten am stärksten abfällt.
+    // Rauschspitzen auf dem induktiven Anstieg fallen nur zu einer Seite ab.
+    std::size_t peak = 0;
+    double prominence = 1.0;
+    for (std::size_t i = 1; i + 1 < n; ++i) {
+        if (zm[i] < zm[i - 1] || zm[i] < zm[i + 1]) {
+            continue;
+        }
+        double left = zm[i];
+        for (std::size_t j = i; j-- > 0 && w[j] >= 0.5 * w[i];) {
+            left = std::min(left, zm[j]);
+        }
+        double right = zm[i];
+        for (std::size_t j = i + 1; j < n && w[j] <= 2.0 * w[i]; ++j) {
+            right = std::min(right, zm[j]);
+        }
+        const double value = zm[i] / std::max(left, right);
+        if (value > prominence) {
+            prominence = value;
+            peak = i;
+        }
+    }
+    if (peak == 0) {
+        peak = static_cast<std::size_t>(std::max_element(zm, zm + n) - zm);
+    }
+    double p[kMaxParameters];
+    p[0] = *std::min_element(zm, zm + n);
+    p[1] = w[peak] / (2.0 * SiVAL::PI);
+    p[2] = 5.0;
+    p[3] = 0.5;
+    const double r0 = zm[peak] / p[0];
+    if (r0 > 1.01) {
+        // Bandbreite bei Re * sqrt(r0)
+        const double level = p[0] * std::sqrt(r0);
+        std::size_t lower = peak;
+        while (lower > 0 && zm[lower] > level) {
+            --lower;
+        }
+        std::size_t upper = peak;
+        while (upper + 1 < n && zm[upper] > level) {
+            ++upper;
+        }
+        if (lower < peak && upper > peak && zm[lower] <= level && zm[upper] <= level) {
+            const double f1 = w[lower] + (w[lower + 1] - w[lower]) * (level - zm[lower]) / (zm[lower + 1] - zm[lower]);
+            const double f2 = w[upper - 1] + (w[upper] - w[upper - 1]) * (zm[upper - 1] - level) / (zm[upper - 1] - zm[upper]);
+            if (f2 > f1) {
+                p[2] = w[peak] * std::sqrt(r0) / (f2 - f1);
+                p[3] = p[2] / (r0 - 1.0);
+            }
+        }
+    }
+    const double wTop = w[n - 1];
+    const double top = settings.usePhase ? workspace.imag[n - 1]
+                                         : std::sqrt(std::max(0.0, zm[n - 1] * zm[n - 1] - p[0] * p[0]));
+    p[kMotional] = std::max(1e-6, top / wTop);
+
+    const Points points{w, workspace.real.data(), workspace.imag.data(), zm, workspace.inverse.data(), n};
+    Result result;
+
+    // --- Zuerst mit einer einfachen Induktivität ---
+    SiVAL::VoiceCoil coil;
+    double cost = levenbergMarquardt(points, p, coil, settings, result);
+
+    // --- Danach das gewünschte Schwingspulenmodell, Startwerte aus Le ---
+    if (settings.voiceCoil != SiVAL::VoiceCoil::Model::Simple) {
+        const double le = coil.le;
+        coil.model = settings.voiceCoil;
+        switch (coil.model) {
+        case SiVAL::VoiceCoil::Model::Simple:
+            break;
+        case SiVAL::VoiceCoil::Model::LR2:
+            coil.le = 0.5 * le;
+            coil.l2 = le;
+            coil.r2 = 0.5 * wTop * le;
+            break;
+        case SiVAL::VoiceCoil::Model::Wright:
+            // |Z_vc(w_top)| wie j w_top Le, Realteil halb so groß
+            coil.exm = 0.7;
+            coil.erm = 0.7;
+            coil.kxm = le * std::pow(wTop, 1.0 - coil.exm);
+            coil.krm = 0.5 * coil.kxm;
+            break;
+        case SiVAL::VoiceCoil::Model::Leach:
+            coil.n = 0.7;
+            coil.k = le * std::pow(wTop, 1.0 - coil.n) / std::sin(0.5 * SiVAL::PI * coil.n);
+            break;
+        }
+        coil.parameters(p + kMotional);
+        result.converged = false;
+        cost = levenbergMarquardt(points, p, coil, settings, result);
+    }
+
+    result.re = p[0];
+    result.fs = p[1];
+    result.qms = p[2];
+    result.qes = p[3];
+    result.qts = p[2] * p[3] / (p[2] + p[3]);
+    result.voiceCoil = coil;
+    if (coil.model == SiVAL::VoiceCoil::Model::Simple || coil.model == SiVAL::VoiceCoil::Model::LR2) {
+        result.le = coil.le;
+    } else {
+        // Ersatzinduktivität bei 1 kHz
+        const double reference = 2.0 * SiVAL::PI * 1000.0;
+        double vr;
+        double vi;
+        coil.evaluate(&reference, &vr, &vi, 1);
+        result.le = vi / reference;
+    }
+    result.error = std::sqrt(cost / static_cast<double>(settings.usePhase ? 2 * n : n));
+    return result;
+}
+//// end private member methods
+} // namespace SiVAL::Response
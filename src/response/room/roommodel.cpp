@@ -0,0 +1,191 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <algorithm>
+#include <cmath>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/response/room/roommodel.hpp"
+#include <sival/core/exceptions.hpp>
+#include <sival/utils/parallel.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+//// end static definitions
+
+namespace SiVAL::Response {
+//// begin static functions
+//// end static functions
+
+//// begin public member methods
+RoomModel::RoomModel(double length, double width, double height, double reverberationTime,
+                     double maxFrequency, double speedOfSound)
+    : m_length(length),
+    m_width(width),
+    m_height(height),
+    m_damping(0.0),
+    m_speedOfSound(speedOfSound) {
+    if (!(length > 0.0) || !(width > 0.0) || !(height > 0.0)
+        || !(reverberationTime > 0.0) || !(maxFrequency > 0.0)) {
+        throw SiVAL::Exceptions::OutOfRange("The room dimensions, the reverberation time and the maximum frequency must be positive.");
+    }
+    // delta = 3 ln(10) / T60
+    m_damping = 3.0 * std::log(10.0) / reverberationTime;
+
+    // Alle Moden mit (c/2) * sqrt((nx/Lx)^2 + (ny/Ly)^2 + (nz/Lz)^2) <= fmax
+    const double kMax = 2.0 * SiVAL::PI * maxFrequency / speedOfSound;
+    const int nxMax = static_cast<int>(kMax * length / SiVAL::PI);
+    const int nyMax = static_cast<int>(kMax * width / SiVAL::PI);
+    const int nzMax = static_cast<int>(kMax * height / SiVAL::PI);
+    for (int nx = 0; nx <= nxMax; ++nx) {
+        const double kx = nx * SiVAL::PI / length;
+        for (int ny = 0; ny <= nyMax; ++ny) {
+            const double ky = ny * SiVAL::PI / width;
+            for (int nz = 0; nz <= nzMax; ++nz) {
+                const double kz = nz * SiVAL::PI / height;
+                const double k2 = kx * kx + ky * ky + kz * kz;
+                if (k2 > kMax * kMax) {
+                    break;
+                }
+                m_kx.push_back(kx);
+                m_ky.push_back(ky);
+                m_kz.push_back(kz);
+                m_omega2.push_back(k2 * speedOfSound * speedOfSound);
+                // 1 / Lambda: Faktor 2 je Raumrichtung mit n > 0
+                m_inverseNorm.push_back((nx > 0 ? 2.0 : 1.0) * (ny > 0 ? 2.0 : 1.0) * (nz > 0 ? 2.0 : 1.0));
+            }
+        }
+    }
+}
+RoomModel::~RoomModel() {
+}
+void RoomModel::apply(const SiVAL::Spectrum &pressure, double distance, const Position &source,
+                      const Position &listener, SiVAL::Spectrum &out) const {
+    if (pressure.size() != m_grid.size()) {
+        throw SiVAL::Exceptions::OutOfRange("The pressure does not match the prepared grid of the room.");
+    }
+    transfer(source, listener, out);
+    // p_1m = p_r * r
+    out.multiply(pressure);
+    out.scale(distance);
+}
+std::vector<double> RoomModel::gainDb(const Position &source, const Position &listener) const {
+    SiVAL::Spectrum h;
+    transfer(source, listener, h);
+    return h.magnitudeDb();
+}
+const SiVAL::FrequencyGrid& RoomModel::grid() const {
+    return m_grid;
+}
+double RoomModel::height() const {
+    return m_height;
+}
+double RoomModel::length() const {
+    return m_length;
+}
+std::size_t RoomModel::modeCount() const {
+    return m_omega2.size();
+}
+double RoomModel::modeFrequency(std::size_t mode) const {
+    return std::sqrt(m_omega2.at(mode)) / (2.0 * SiVAL::PI);
+}
+void RoomModel::prepare(const SiVAL::FrequencyGrid &grid) {
+    const std::size_t n = grid.size();
+    const std::size_t modes = m_omega2.size();
+    m_grid = grid;
+    m_denominatorReal.resize(modes * n);
+    m_denominatorImag.resize(modes * n);
+
+    const double scale = 2.0 * SiVAL::PI * m_speedOfSound * m_speedOfSound / (m_length * m_width * m_height);
+    const double* __restrict w = grid.omega().data();
+    for (std::size_t m = 0; m < modes; ++m) {
+        const double wn2 = m_omega2[m];
+        double* __restrict dr = m_denominatorReal.data() + m * n;
+        double* __restrict di = m_denominatorImag.data() + m * n;
+        for (std::size_t i = 0; i < n; ++i) {
+            // scale / (a + jb) = scale * (a - jb) / (a^2 + b^2)
+            const double a = wn2 - w[i] * w[i];
+            const double b = 2.0 * m_damping * w[i];
+            const double d = scale / (a * a + b * b);
+            dr[i] = a * d;
+            di[i] = -b * d;
+        }
+    }
+}
+void RoomModel::transfer(const Position &source, const Position &listener, SiVAL::Spectrum &out) const {
+    if (m_grid.empty()) {
+        throw SiVAL::Exceptions::OutOfRange("The room model has no prepared frequency grid.");
+    }
+    check(source);
+    check(listener);
+
+    const std::size_t n = m_grid.size();
+    const std::size_t modes = m_omega2.size();
+    out.resize(n);
+    double* __restrict hr = out.real();
+    double* __restrict hi = out.imag();
+    std::fill(hr, hr + n, 0.0);
+    std::fill(hi, hi + n, 0.0);
+
+    for (std::size_t m = 0; m < modes; ++m) {
+        const double c = m_inverseNorm[m]
+                         * std::cos(m_kx[m] * source.x) * std::cos(m_kx[m] * listener.x)
+                         * std::cos(m_ky[m] * source.y) * std::cos(m_ky[m] * listener.y)
+                         * std::cos(m_kz[m] * source.z) * std::cos(m_kz[m] * listener.z);
+        const double* __restrict dr = m_denominatorReal.data() + m * n;
+        const double* __restrict di = m_denominatorImag.data() + m * n;
+        for (std::size_t i = 0; i < n; ++i) {
+            hr[i] += c * dr[i];
+            hi[i] += c * di[i];
+        }
+    }
+}
+void RoomModel::transfer(const Position &source, const std::vector<Position> &listeners,
+                         std::vector<SiVAL::Spectrum> &out, std::size_t threads) const {
+    out.resize(listeners.size());
+    SiVAL::Utils::parallelFor(listeners.size(), [&](std::size_t index, std::size_t) {
+        transfer(source, listeners[index], out[index]);
+    }, threads);
+}
+double RoomModel::width() const {
+    return m_width;
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+void RoomModel::check(const Position &position) const {
+    if (position.x < 0.0 || position.x > m_length || position.y < 0.0 || position.y > m_width
+        || position.z < 0.0 || position.z > m_height) {
+        throw SiVAL::Exceptions::OutOfRange("The position is outside of the room.");
+    }
+}
+//// end private member methods
+} // namespace SiVAL::Response
@@ -0,0 +1,352 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <algorithm>
+#include <cmath>
+#include <limits>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/response/room/subplacement.hpp"
+#include <sival/core/exceptions.hpp>
+#include <sival/utils/parallel.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+/// Initial step of the gain search in dB.
+static constexpr double kGainStep = 3.0;
+/// The gain search stops below this step in dB.
+static constexpr double kGainResolution = 0.05;
+/// The delay search stops below this step in seconds.
+static constexpr double kDelayResolution = 1e-5;
+/// Keeps the level finite in pressure zeros (-200 dB relative).
+static constexpr double kPowerFloor = 1e-20;
+//// end static definitions
+
+namespace SiVAL::Response {
+//// begin static functions
+//// end static functions
+
+/**
+ * @brief Per-thread buffers and the best placement of the worker.
+ */
+struct SubwooferPlacement::Workspace {
+    Workspace(std::size_t subs, std::size_t seats, std::size_t band)
+        : weightReal(subs * band), weightImag(subs * band), sumReal(band), sumImag(band),
+        level(seats * band), gains(subs, 0.0), delays(subs, 0.0),
+        bestGains(subs, 0.0), bestDelays(subs, 0.0) {
+    }
+
+    std::vector<double> weightReal;
+    std::vector<double> weightImag;
+    std::vector<double> sumReal;
+    std::vector<double> sumImag;
+    std::vector<double> level;
+    std::vector<double> gains;
+    std::vector<double> delays;
+
+    double bestCost = std::numeric_limits<double>::infinity();
+    std::size_t bestCombination = 0;
+    std::vector<double> bestGains;
+    std::vector<double> bestDelays;
+};
+
+//// begin public member methods
+SubwooferPlacement::SubwooferPlacement(const RoomModel &room, const SiVAL::Spectrum &pressure, double distance)
+    : m_room(room),
+    m_pressure(pressure),
+    m_prepared(false),
+    m_begin(0),
+    m_end(0) {
+    if (pressure.size() != room.grid().size()) {
+        throw SiVAL::Exceptions::OutOfRange("The subwoofer pressure does not match the prepared grid of the room.");
+    }
+    // Auf 1 m im Halbraum normieren
+    m_pressure.scale(distance);
+}
+SubwooferPlacement::~SubwooferPlacement() {
+}
+void SubwooferPlacement::addCandidate(const RoomModel::Position &position) {
+    m_candidates.push_back(position);
+    m_prepared = false;
+}
+void SubwooferPlacement::addSeat(const RoomModel::Position &position) {
+    m_seats.push_back(position);
+    m_prepared = false;
+}
+const std::vector<RoomModel::Position>& SubwooferPlacement::candidates() const {
+    return m_candidates;
+}
+double SubwooferPlacement::cost(const std::vector<std::size_t> &candidates, const std::vector<double> &gains,
+                                const std::vector<double> &delays, const Settings &settings) {
+    if (candidates.empty() || gains.size() != candidates.size() || delays.size() != candidates.size()) {
+        throw SiVAL::Exceptions::OutOfRange("Every subwoofer needs a candidate, a gain and a delay.");
+    }
+    for (std::size_t c : candidates) {
+        if (c >= m_candidates.size()) {
+            throw SiVAL::Exceptions::OutOfRange("The candidate index is out of range.");
+        }
+    }
+    prepare(settings);
+    Workspace workspace(candidates.size(), m_seats.size(), m_end - m_begin);
+    return evaluate(workspace, candidates.data(), gains.data(), delays.data());
+}
+SubwooferPlacement::Result SubwooferPlacement::optimize(const Settings &settings) {
+    const std::size_t subs = settings.subs;
+    const std::size_t count = m_candidates.size();
+    if (subs < 1 || count < subs) {
+        throw SiVAL::Exceptions::OutOfRange("There are fewer candidate positions than subwoofers.");
+    }
+    prepare(settings);
+
+    // Alle Kombinationen (aufsteigende Indizes) vorab erzeugen
+    std::vector<std::size_t> combinations;
+    std::vector<std::size_t> current(subs);
+    for (std::size_t k = 0; k < subs; ++k) {
+        current[k] = k;
+    }
+    while (true) {
+        combinations.insert(combinations.end(), current.begin(), current.end());
+        std::size_t k = subs;
+        while (k > 0 && current[k - 1] == count - subs + k - 1) {
+            --k;
+        }
+        if (k == 0) {
+            break;
+        }
+        ++current[k - 1];
+        for (std::size_t j = k; j < subs; ++j) {
+            current[j] = current[j - 1] + 1;
+        }
+    }
+    const std::size_t total = combinations.size() / subs;
+
+    const std::size_t workers = SiVAL::Utils::threadCount(settings.threads, total);
+    std::vector<Workspace> workspaces;
+    workspaces.reserve(workers);
+    for (std::size_t w = 0; w < workers; ++w) {
+        workspaces.emplace_back(subs, m_seats.size(), m_end - m_begin);
+    }
+
+    SiVAL::Utils::parallelFor(total, [&](std::size_t index, std::size_t worker) {
+        Workspace &workspace = workspaces[worker];
+        const double c = search(workspace, combinations.data() + index * subs, settings);
+        if (c < workspace.bestCost || (c == workspace.bestCost && index < workspace.bestCombination)) {
+            workspace.bestCost = c;
+            workspace.bestCombination = index;
+            workspace.bestGains = workspace.gains;
+            workspace.bestDelays = workspace.delays;
+        }
+    }, workers);
+
+    const Workspace* best = &workspaces.front();
+    for (const Workspace &workspace : workspaces) {
+        if (workspace.bestCost < best->bestCost
+            || (workspace.bestCost == best->bestCost && workspace.bestCombination < best->bestCombination)) {
+            best = &workspace;
+        }
+    }
+
+    Result result;
+    result.candidates.assign(combinations.begin() + best->bestCombination * subs,
+                             combinations.begin() + (best->bestCombination + 1) * subs);
+    for (std::size_t c : result.candidates) {
+        result.positions.push_back(m_candidates[c]);
+    }
+    result.gains = best->bestGains;
+    result.delays = best->bestDelays;
+    result.cost = best->bestCost;
+    result.combinations = total;
+    return result;
+}
+const std::vector<RoomModel::Position>& SubwooferPlacement::seats() const {
+    return m_seats;
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+void SubwooferPlacement::prepare(const Settings &settings) {
+    if (m_seats.size() < 2) {
+        throw SiVAL::Exceptions::OutOfRange("The listening area needs at least two seats.");
+    }
+    const SiVAL::FrequencyGrid &grid = m_room.grid();
+    const std::vector<double> &f = grid.frequencies();
+    const std::size_t begin = std::lower_bound(f.begin(), f.end(), settings.minFrequency) - f.begin();
+    const std::size_t end = std::upper_bound(f.begin(), f.end(), settings.maxFrequency) - f.begin();
+    if (begin >= end) {
+        throw SiVAL::Exceptions::OutOfRange("The optimization band contains no frequency of the grid.");
+    }
+    if (m_prepared && begin == m_begin && end == m_end) {
+        return;
+    }
+    m_begin = begin;
+    m_end = end;
+    const std::size_t band = end - begin;
+    const std::size_t seats = m_seats.size();
+    m_transferReal.resize(m_candidates.size() * seats * band);
+    m_transferImag.resize(m_candidates.size() * seats * band);
+
+    // Raumübertragung je Kandidat und Sitz einmal berechnen
+    SiVAL::Utils::parallelFor(m_candidates.size(), [&](std::size_t c, std::size_t) {
+        SiVAL::Spectrum h;
+        for (std::size_t s = 0; s < seats; ++s) {
+            m_room.transfer(m_candidates[c], m_seats[s], h);
+            const double* __restrict hr = h.real() + begin;
+            const double* __restrict hi = h.imag() + begin;
+            const double* __restrict pr = m_pressure.real() + begin;
+            const double* __restrict pi = m_pressure.imag() + begin;
+            double* __restrict tr = m_transferReal.data() + (c * seats + s) * band;
+            double* __restrict ti = m_transferImag.data() + (c * seats + s) * band;
+            for (std::size_t i = 0; i < band; ++i) {
+                tr[i] = hr[i] * pr[i] - hi[i] * pi[i];
+                ti[i] = hr[i] * pi[i] + hi[i] * pr[i];
+            }
+        }
+    }, settings.threads);
+    m_prepared = true;
+}
+double SubwooferPlacement::evaluate(Workspace &workspace, const std::size_t* candidates, const double* gains,
+                                    const double* delays) const {
+    const std::size_t subs = workspace.gains.size();
+    const std::size_t seats = m_seats.size();
+    const std::size_t band = m_end - m_begin;
+    const double* __restrict w = m_room.grid().omega().data() + m_begin;
+
+    // Gewicht je Subwoofer: g * exp(-j w tau)
+    for (std::size_t k = 0; k < subs; ++k) {
+        const double g = std::pow(10.0, gains[k] / 20.0);
+        double* __restrict wr = workspace.weightReal.data() + k * band;
+        double* __restrict wi = workspace.weightImag.data() + k * band;
+        for (std::size_t i = 0; i < band; ++i) {
+            wr[i] = g * std::cos(w[i] * delays[k]);
+            wi[i] = -g * std::sin(w[i] * delays[k]);
+        }
+    }
+
+    double* __restrict sr = workspace.sumReal.data();
+    double* __restrict si = workspace.sumImag.data();
+    for (std::size_t s = 0; s < seats; ++s) {
+        std::fill(sr, sr + band, 0.0);
+        std::fill(si, si + band, 0.0);
+        for (std::size_t k = 0; k < subs; ++k) {
+            const double* __restrict tr = m_transferReal.data() + (candidates[k] * seats + s) * band;
+            const double* __restrict ti = m_transferImag.data() + (candidates[k] * seats + s) * band;
+            const double* __restrict wr = workspace.weightReal.data() + k * band;
+            const double* __restrict wi = workspace.weightImag.data() + k * band;
+            for (std::size_t i = 0; i < band; ++i) {
+                sr[i] += tr[i] * wr[i] - ti[i] * wi[i];
+                si[i] += tr[i] * wi[i] + ti[i] * wr[i];
+            }
+        }
+        double* __restrict level = workspace.level.data() + s * band;
+        for (std::size_t i = 0; i < band; ++i) {
+            level[i] = 10.0 * std::log10(sr[i] * sr[i] + si[i] * si[i] + kPowerFloor);
+        }
+    }
+
+    // Varianz über die Sitze je Frequenz, gemittelt über das Band
+    double* __restrict mean = sr;
+    double* __restrict square = si;
+    std::fill(mean, mean + band, 0.0);
+    std::fill(square, square + band, 0.0);
+    for (std::size_t s = 0; s < seats; ++s) {
+        const double* __restrict level = workspace.level.data() + s * band;
+        for (std::size_t i = 0; i < band; ++i) {
+            mean[i] += level[i];
+            square[i] += level[i] * level[i];
+        }
+    }
+    const double inverseSeats = 1.0 / static_cast<double>(seats);
+    double cost = 0.0;
+    for (std::size_t i = 0; i < band; ++i) {
+        const double m = mean[i] * inverseSeats;
+        cost += std::max(0.0, square[i] * inverseSeats - m * m);
+    }
+    return cost / static_cast<double>(band);
+}
+double SubwooferPlacement::search(Workspace &workspace, const std::size_t* candidates, const Settings &settings) const {
+    const std::size_t subs = workspace.gains.size();
+    std::vector<double> &gains = workspace.gains;
+    std::vector<double> &delays = workspace.delays;
+    std::fill(gains.begin(), gains.end(), std::clamp(0.0, settings.minGain, settings.maxGain));
+    std::fill(delays.begin(), delays.end(), 0.0);
+
+    double best = evaluate(workspace, candidates, gains.data(), delays.data());
+    double gainStep = settings.optimizeGain ? kGainStep : 0.0;
+    double delayStep = settings.optimizeDelay ? 0.25 * settings.maxDelay : 0.0;
+
+    // Mustersuche: der erste Subwoofer ist die Referenz der Pegel, die Laufzeiten aller Subwoofer werden gesucht
+    auto tryStep = [&](double &value, double step, double lower, double upper) {
+        for (double direction : {1.0, -1.0}) {
+            const double old = value;
+            value = std::clamp(old + direction * step, lower, upper);
+            if (value == old) {
+                continue;
+            }
+            const double c = evaluate(workspace, candidates, gains.data(), delays.data());
+            if (c < best) {
+                best = c;
+                return true;
+            }
+            value = old;
+        }
+        return false;
+    };
+
+    for (std::size_t iteration = 0; iteration < settings.iterations; ++iteration) {
+        const bool searchGain = gainStep >= kGainResolution;
+        const bool searchDelay = delayStep >= kDelayResolution;
+        if (!searchGain && !searchDelay) {
+            break;
+        }
+        bool improved = false;
+        for (std::size_t k = 0; k < subs; ++k) {
+            if (searchGain && k > 0) {
+                improved |= tryStep(gains[k], gainStep, settings.minGain, settings.maxGain);
+            }
+            if (searchDelay) {
+                improved |= tryStep(delays[k], delayStep, 0.0, settings.maxDelay);
+            }
+        }
+        if (!improved) {
+            gainStep *= 0.5;
+            delayStep *= 0.5;
+        }
+    }
+
+    // Eine gemeinsame Laufzeit ändert die Pegel nicht: der früheste Subwoofer bekommt 0
+    const double earliest = *std::min_element(delays.begin(), delays.end());
+    for (double &delay : delays) {
+        delay -= earliest;
+    }
+    return best;
+}
+//// end private member methods
+} // namespace SiVAL::Response
@@ -0,0 +1,233 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <cmath>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/response/system/drivermodel.hpp"
+#include <sival/abstractions/driver.hpp>
+#include <sival/core/exceptions.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+//// end static definitions
+
+namespace SiVAL::Response {
+//// begin static functions
+//// end static functions
+
+//// begin public member methods
+DriverModel::DriverModel(const RoleConfig &config, AbstractEnclosure &enclosure, double densityOfAir, double speedOfSound,
+                         const DriveSource &source)
+    : m_densityOfAir(densityOfAir) {
+    if (!config.driver) {
+        throw SiVAL::Exceptions::OutOfRange("The role configuration contains no driver.");
+    }
+    if (config.count < 1) {
+        throw SiVAL::Exceptions::OutOfRange("The driver count must be at least 1.");
+    }
+    if (enclosure.type() != SiVAL::EnclosureType::Sealed) {
+        // Für Bassreflex fehlen Portmaße und Portmodell, ein geschlossenes Ergebnis wäre falsch
+        throw SiVAL::Exceptions::OutOfRange("The system model supports only sealed enclosures.");
+    }
+    const int count = config.count;
+
+    // s drivers in series per string, p strings in parallel, a = radiating share of Sd
+    int series = 1;
+    double radiating = 1.0;
+    switch (config.wiring) {
+    case SiVAL::Wiring::Parallel:
+        break;
+    case SiVAL::Wiring::Series:
+        series = count;
+        break;
+    case SiVAL::Wiring::SeriesParallel:
+        series = config.series;
+        if (series < 1 || count % series != 0) {
+            throw SiVAL::Exceptions::OutOfRange("The driver count must be a multiple of the drivers in series.");
+        }
+        break;
+    case SiVAL::Wiring::Isobaric:
+        radiating = 0.5;
+        [[fallthrough]];
+    case SiVAL::Wiring::PushPull:
+        if (count % 2 != 0) {
+            throw SiVAL::Exceptions::OutOfRange("The wiring " + SiVAL::wiringToString(config.wiring) + " needs an even driver count.");
+        }
+        break;
+    }
+    const double n = static_cast<double>(count);
+    const double s = static_cast<double>(series);
+    const double p = n / s;
+
+    const AbstractDriver &driver = *config.driver;
+    const double ws = 2.0 * SiVAL::PI * driver.fs();
+
+    // Equivalent driver of the whole array
+    m_coefficients.re = driver.re() * s / p;
+    m_coefficients.le = driver.le() * s / p;
+    m_coefficients.voiceCoil = driver.voiceCoil().scaled(s / p);
+    m_coefficients.bl = driver.bl() * s;
+    m_coefficients.mms = driver.mms() * n;
+    m_coefficients.rms = driver.rms() * n;
+    m_coefficients.kms = ws * ws * driver.mms() * n;
+    m_coefficients.sd = driver.sd() * n * radiating;
+    m_coefficients.rg = source.resistance();
+
+    // Derived values: Vas = rho c^2 Sd^2 / Kms, p = rho Sd Bl U / (2 pi r Re Mms)
+    const double rc2 = densityOfAir * speedOfSound * speedOfSound;
+    m_coefficients.vas = rc2 * m_coefficients.sd * m_coefficients.sd / m_coefficients.kms;
+    const double passband = densityOfAir * m_coefficients.sd * m_coefficients.bl * 2.83
+                            / (2.0 * SiVAL::PI * m_coefficients.re * m_coefficients.mms);
+    m_coefficients.sensitivity = 20.0 * std::log10(passband / SiVAL::P_REF);
+
+    // Effective Qts: Qes grows with the source resistance, Qms = ws Mms / Rms
+    const double qms = ws * m_coefficients.mms / m_coefficients.rms;
+    const double qes = ws * m_coefficients.mms * (m_coefficients.re + m_coefficients.rg) / (m_coefficients.bl * m_coefficients.bl);
+    m_coefficients.qts = qms * qes / (qms + qes);
+
+    // Konstante Leistung an Re: I = sqrt(P / Re), die Quelle muss zusätzlich den Abfall an Rg liefern
+    m_sourceVoltage = source.mode == DriveSource::Mode::ConstantPower
+                      ? std::sqrt(source.power / m_coefficients.re) * (m_coefficients.re + m_coefficients.rg)
+                      : source.voltage;
+
+    // Volume in liters, 0 means infinite baffle
+    const double vb = enclosure.volume() * 1e-3;
+    if (vb > 0.0) {
+        m_coefficients.kmb = rc2 * m_coefficients.sd * m_coefficients.sd / vb;
+    }
+}
+const DriverModel::Coefficients& DriverModel::coefficients() const {
+    return m_coefficients;
+}
+void DriverModel::impedance(const FrequencyGrid &grid, Spectrum &out) const {
+    const std::size_t n = grid.size();
+    out.resize(n);
+
+    const double re = m_coefficients.re;
+    const double bl2 = m_coefficients.bl * m_coefficients.bl;
+    const double mms = m_coefficients.mms;
+    const double rms = m_coefficients.rms;
+    const double k = m_coefficients.kms + m_coefficients.kmb;
+
+    std::vector<double> bufferReal;
+    std::vector<double> bufferImag;
+    const double* coilReal;
+    const double* coilImag;
+    voiceCoil(grid, bufferReal, bufferImag, coilReal, coilImag);
+
+    const double* __restrict w = grid.omega().data();
+    const double* __restrict vr = coilReal;
+    const double* __restrict vi = coilImag;
+    double* __restrict zr = out.real();
+    double* __restrict zi = out.imag();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        // Z = Ze + Bl^2 / Zm
+        const double x = w[i] * mms - k / w[i];
+        const double s = bl2 / (rms * rms + x * x);
+        zr[i] = re + vr[i] + s * rms;
+        zi[i] = vi[i] - s * x;
+    }
+}
+void DriverModel::prepare(const FrequencyGrid &grid) {
+    m_grid = grid;
+    m_coilReal.resize(grid.size());
+    m_coilImag.resize(grid.size());
+    m_coefficients.voiceCoil.evaluate(grid.omega().data(), m_coilReal.data(), m_coilImag.data(), grid.size());
+}
+void DriverModel::pressure(const FrequencyGrid &grid, double voltage, double distance, Spectrum &out, double delay,
+                           bool source) const {
+    const std::size_t n = grid.size();
+    out.resize(n);
+
+    const double re = source ? m_coefficients.re + m_coefficients.rg : m_coefficients.re;
+    const double bl2 = m_coefficients.bl * m_coefficients.bl;
+    const double mms = m_coefficients.mms;
+    const double rms = m_coefficients.rms;
+    const double k = m_coefficients.kms + m_coefficients.kmb;
+    const double a = m_densityOfAir * m_coefficients.sd * m_coefficients.bl * voltage / (2.0 * SiVAL::PI * distance);
+
+    std::vector<double> bufferReal;
+    std::vector<double> bufferImag;
+    const double* coilReal;
+    const double* coilImag;
+    voiceCoil(grid, bufferReal, bufferImag, coilReal, coilImag);
+
+    const double* __restrict w = grid.omega().data();
+    const double* __restrict vr = coilReal;
+    const double* __restrict vi = coilImag;
+    double* __restrict pr = out.real();
+    double* __restrict pi = out.imag();
+
+    for (std::size_t i = 0; i < n; ++i) {
+        // den = Ze * Zm + Bl^2, Ze = (re + vr) + j vi, Zm = rms + j x
+        const double x = w[i] * mms - k / w[i];
+        const double er = re + vr[i];
+        const double dr = er * rms - vi[i] * x + bl2;
+        const double di = er * x + vi[i] * rms;
+        // p = a * w * j / den
+        const double s = a * w[i] / (dr * dr + di * di);
+        pr[i] = s * di;
+        pi[i] = s * dr;
+    }
+
+    if (delay != 0.0) {
+        for (std::size_t i = 0; i < n; ++i) {
+            const double c = std::cos(w[i] * delay);
+            const double d = std::sin(w[i] * delay);
+            const double r = pr[i] * c + pi[i] * d;
+            pi[i] = pi[i] * c - pr[i] * d;
+            pr[i] = r;
+        }
+    }
+}
+double DriverModel::sourceVoltage() const {
+    return m_sourceVoltage;
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+void DriverModel::voiceCoil(const FrequencyGrid &grid, std::vector<double> &real, std::vector<double> &imag,
+                            const double* &coilReal, const double* &coilImag) const {
+    if (!m_grid.empty() && m_grid == grid) {
+        coilReal = m_coilReal.data();
+        coilImag = m_coilImag.data();
+        return;
+    }
+    real.resize(grid.size());
+    imag.resize(grid.size());
+    m_coefficients.voiceCoil.evaluate(grid.omega().data(), real.data(), imag.data(), grid.size());
+    coilReal = real.data();
+    coilImag = imag.data();
+}
+//// end private member methods
+} // namespace SiVAL::Response
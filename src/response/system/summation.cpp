@@ -0,0 +1,242 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <algorithm>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/response/system/summation.hpp"
+#include <sival/acousticsetup.hpp>
+#include <sival/core/exceptions.hpp>
+#include <sival/crossover/solver.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+/// Number of grid points that are summed up at once. Small enough to stay in the L1 cache.
+static constexpr std::size_t kBlockSize = 256;
+//// end static definitions
+
+namespace SiVAL::Response {
+//// begin static functions
+//// end static functions
+
+//// begin public member methods
+Summation::Summation(SiVAL::AcousticSetup &setup)
+    : AbstractResponse(SiVAL::ResponseType::SystemSpl, setup.enclosure()),
+    m_setup(setup),
+    m_distance(1.0),
+    m_prepared(false) {
+}
+Summation::~Summation() {
+}
+double Summation::distance() const {
+    return m_distance;
+}
+const SiVAL::Spectrum& Summation::evaluate() {
+    if (!m_prepared) {
+        prepare();
+    }
+    const std::size_t n = m_grid.size();
+    m_sum.resize(n);
+
+    double* __restrict sr = m_sum.real();
+    double* __restrict si = m_sum.imag();
+
+    // Blockweise summieren: der Block der Summe bleibt im Cache, während alle Rollen
+    // addiert werden. Jede Frequenz wird damit nur einmal aus dem Speicher geladen.
+    for (std::size_t begin = 0; begin < n; begin += kBlockSize) {
+        const std::size_t end = std::min(n, begin + kBlockSize);
+        std::fill(sr + begin, sr + end, 0.0);
+        std::fill(si + begin, si + end, 0.0);
+
+        for (const auto &[role, entry] : m_roles) {
+            const double* __restrict pr = entry.pressure.real();
+            const double* __restrict pi = entry.pressure.imag();
+            for (std::size_t i = begin; i < end; ++i) {
+                sr[i] += pr[i];
+                si[i] += pi[i];
+            }
+        }
+    }
+    return m_sum;
+}
+const SiVAL::Spectrum& Summation::evaluate(const SiVAL::Crossover::Solver &crossover) {
+    if (!m_prepared) {
+        prepare();
+    }
+    if (!(crossover.grid() == m_grid)) {
+        throw SiVAL::Exceptions::OutOfRange("The crossover was solved on a different frequency grid.");
+    }
+    if (crossover.sourceResistance() != m_source.resistance()) {
+        throw SiVAL::Exceptions::OutOfRange("The crossover was solved with a different source resistance.");
+    }
+    const std::size_t n = m_grid.size();
+    m_sum.resize(n);
+
+    double* __restrict sr = m_sum.real();
+    double* __restrict si = m_sum.imag();
+
+    for (std::size_t begin = 0; begin < n; begin += kBlockSize) {
+        const std::size_t end = std::min(n, begin + kBlockSize);
+        std::fill(sr + begin, sr + end, 0.0);
+        std::fill(si + begin, si + end, 0.0);
+
+        for (const auto &[role, entry] : m_roles) {
+            if (!crossover.contains(role)) {
+                const double* __restrict pr = entry.pressure.real();
+                const double* __restrict pi = entry.pressure.imag();
+                for (std::size_t i = begin; i < end; ++i) {
+                    sr[i] += pr[i];
+                    si[i] += pi[i];
+                }
+                continue;
+            }
+            // Rg steckt bereits in der Übertragungsfunktion der Weiche
+            const SiVAL::Spectrum &terminal = entry.terminal.size() == 0 ? entry.pressure : entry.terminal;
+            const double* __restrict pr = terminal.real();
+            const double* __restrict pi = terminal.imag();
+            const SiVAL::Spectrum &transfer = crossover.transfer(role);
+            const double* __restrict hr = transfer.real();
+            const double* __restrict hi = transfer.imag();
+            for (std::size_t i = begin; i < end; ++i) {
+                sr[i] += pr[i] * hr[i] - pi[i] * hi[i];
+                si[i] += pr[i] * hi[i] + pi[i] * hr[i];
+            }
+        }
+    }
+    return m_sum;
+}
+const SiVAL::FrequencyGrid& Summation::grid() const {
+    return m_grid;
+}
+const DriverModel& Summation::model(SiVAL::DriverRole role) const {
+    auto it = m_roles.find(role);
+    if (it == m_roles.end()) {
+        throw SiVAL::Exceptions::OutOfRange("There is no response for the role: " + SiVAL::roleToString(role));
+    }
+    return it->second.model;
+}
+void Summation::prepare() {
+    m_roles.clear();
+
+    double densityOfAir = SiVAL::RHO0;
+    double speedOfSound = SiVAL::C_SOUND;
+    if (std::shared_ptr<SiVAL::Environment> env = m_setup.environment()) {
+        densityOfAir = env->densityOfAir();
+        speedOfSound = env->speedOfSound();
+    }
+
+    for (SiVAL::DriverRole role : m_setup.roles()) {
+        const RoleConfig* config = m_setup.driverByRole(role);
+        Role entry{DriverModel(*config, m_setup.enclosure(), densityOfAir, speedOfSound, m_source),
+                   config->delay + config->offset / speedOfSound,
+                   config->inverted ? -1.0 : 1.0,
+                   SiVAL::Spectrum(),
+                   SiVAL::Spectrum()};
+        entry.model.prepare(m_grid);
+        entry.model.pressure(m_grid, entry.sign * entry.model.sourceVoltage(), m_distance, entry.pressure, entry.delay);
+        if (m_source.resistance() != 0.0) {
+            entry.model.pressure(m_grid, entry.sign * entry.model.sourceVoltage(), m_distance, entry.terminal,
+                                 entry.delay, false);
+        }
+        m_roles.emplace(role, std::move(entry));
+    }
+    m_prepared = true;
+}
+double Summation::response(double frequency) {
+    if (!m_prepared) {
+        prepare();
+    }
+    const SiVAL::FrequencyGrid point(std::vector<double>{frequency});
+    SiVAL::Spectrum total(1);
+    SiVAL::Spectrum pressure;
+
+    for (const auto &[role, entry] : m_roles) {
+        entry.model.pressure(point, entry.sign * entry.model.sourceVoltage(), m_distance, pressure, entry.delay);
+        total.accumulate(pressure);
+    }
+    return total.magnitudeDb(SiVAL::P_REF).front();
+}
+const SiVAL::Spectrum& Summation::roleResponse(SiVAL::DriverRole role) const {
+    auto it = m_roles.find(role);
+    if (it == m_roles.end()) {
+        throw SiVAL::Exceptions::OutOfRange("There is no response for the role: " + SiVAL::roleToString(role));
+    }
+    return it->second.pressure;
+}
+const SiVAL::Spectrum& Summation::terminalResponse(SiVAL::DriverRole role) const {
+    auto it = m_roles.find(role);
+    if (it == m_roles.end()) {
+        throw SiVAL::Exceptions::OutOfRange("There is no response for the role: " + SiVAL::roleToString(role));
+    }
+    return it->second.terminal.size() == 0 ? it->second.pressure : it->second.terminal;
+}
+std::vector<SiVAL::DriverRole> Summation::roles() const {
+    std::vector<SiVAL::DriverRole> result;
+    result.reserve(m_roles.size());
+    for (const auto &[role, entry] : m_roles) {
+        result.push_back(role);
+    }
+    return result;
+}
+void Summation::setDistance(double distance) {
+    m_distance = distance;
+    m_prepared = false;
+}
+void Summation::setGrid(const SiVAL::FrequencyGrid &grid) {
+    m_grid = grid;
+    m_prepared = false;
+}
+void Summation::setSource(const SiVAL::DriveSource &source) {
+    m_source = source;
+    m_prepared = false;
+}
+void Summation::setVoltage(double voltage) {
+    m_source.mode = SiVAL::DriveSource::Mode::ConstantVoltage;
+    m_source.voltage = voltage;
+    m_prepared = false;
+}
+const SiVAL::DriveSource& Summation::source() const {
+    return m_source;
+}
+std::vector<double> Summation::spl() const {
+    return m_sum.magnitudeDb(SiVAL::P_REF);
+}
+const SiVAL::Spectrum& Summation::sum() const {
+    return m_sum;
+}
+double Summation::voltage() const {
+    return m_source.voltage;
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+//// end private member methods
+} // namespace SiVAL::Response
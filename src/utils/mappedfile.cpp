@@ -0,0 +1,153 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <utility>
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+//// end system includes
+
+//// begin project specific includes
+#include "sival/utils/mappedfile.hpp"
+#include <sival/core/exceptions.hpp>
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+//// end static definitions
+
+namespace SiVAL::Utils {
+//// begin static functions
+//// end static functions
+
+//// begin public member methods
+MappedFile::MappedFile(const std::string &path)
+    : m_data(nullptr),
+    m_size(0) {
+#if defined(_WIN32)
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw SiVAL::Exceptions::FileAccessError("Cannot open file: " + path);
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        throw SiVAL::Exceptions::FileAccessError("Cannot read the size of file: " + path);
+    }
+    m_size = static_cast<std::size_t>(size.QuadPart);
+    if (m_size > 0) {
+        HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mapping != nullptr) {
+            m_data = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+            // Die View hält das Mapping selbst am Leben
+            CloseHandle(mapping);
+        }
+    }
+    CloseHandle(file);
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        throw SiVAL::Exceptions::FileAccessError("Cannot open file: " + path);
+    }
+    struct stat status;
+    if (::fstat(fd, &status) != 0) {
+        ::close(fd);
+        throw SiVAL::Exceptions::FileAccessError("Cannot read the size of file: " + path);
+    }
+    m_size = static_cast<std::size_t>(status.st_size);
+    if (m_size > 0) {
+        void* address = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address != MAP_FAILED) {
+            m_data = static_cast<const char*>(address);
+            ::madvise(address, m_size, MADV_SEQUENTIAL);
+        }
+    }
+    // Das Mapping bleibt nach close() gültig
+    ::close(fd);
+#endif
+    if (m_size > 0 && m_data == nullptr) {
+        m_size = 0;
+        throw SiVAL::Exceptions::FileAccessError("Cannot map file: " + path);
+    }
+}
+MappedFile::MappedFile(MappedFile &&other) noexcept
+    : m_data(std::exchange(other.m_data, nullptr)),
+    m_size(std::exchange(other.m_size, 0)) {
+}
+MappedFile& MappedFile::operator=(MappedFile &&other) noexcept {
+    if (this != &other) {
+        release();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+    }
+    return *this;
+}
+MappedFile::~MappedFile() {
+    release();
+}
+const char* MappedFile::begin() const {
+    return m_data;
+}
+const char* MappedFile::data() const {
+    return m_data;
+}
+bool MappedFile::empty() const {
+    return m_size == 0;
+}
+const char* MappedFile::end() const {
+    return m_data + m_size;
+}
+std::size_t MappedFile::size() const {
+    return m_size;
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+void MappedFile::release() {
+    if (m_data != nullptr) {
+#if defined(_WIN32)
+        UnmapViewOfFile(m_data);
+#else
+        ::munmap(const_cast<char*>(m_data), m_size);
+#endif
+        m_data = nullptr;
+        m_size = 0;
+    }
+}
+//// end private member methods
+} // namespace SiVAL::Utils
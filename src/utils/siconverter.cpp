@@ -10,6 +10,10 @@
 //// end includes
 
 //// begin system includes
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
 //// end system includes
 
 //// begin project specific includes
@@ -28,69 +32,140 @@
 namespace SiVAL::Utils {
 
 //// begin static definitions
+/// A unit string and its unit.
+struct UnitName {
+    std::string_view name;
+    Unit unit;
+};
+/// The unit strings of the datasheets (see the tables of the `to...` methods).
+static constexpr std::array<UnitName, 20> kUnits = {{
+    {"m", Units::m}, {"cm", Units::cm}, {"mm", Units::mm}, {"in", Units::in}, {"ft", Units::ft},
+    {"m2", Units::m2}, {"cm2", Units::cm2}, {"in2", Units::in2}, {"ft2", Units::ft2},
+    {"m3", Units::m3}, {"dm3", Units::dm3}, {"L", Units::L}, {"l", Units::L}, {"cm3", Units::cm3},
+    {"in3", Units::in3}, {"ft3", Units::ft3},
+    {"kg", Units::kg}, {"g", Units::g}, {"oz", Units::oz}, {"lb", Units::lb},
+}};
+/**
+ * @brief The distinct units of a unit column and which of them every value has.
+ * @details At most `kUnits.size()` strings are valid, so a byte per value suffices.
+ */
+struct UnitColumn {
+    std::vector<double> factors;
+    std::vector<std::uint8_t> slots;
+};
 //// end static definitions
 
 //// begin static functions
-double SIConverter::toArea(double value, const std::string& unit) {
-    if (unit == "cm2") {
-        return value * 1e-4; // 1 cm² = 0.0001 m²
-    }
-    if (unit == "in2") {
-        return value * 0.00064516; // 1 in² = 0.00064516 m²
+/**
+ * @brief Groups the values of a unit column by unit.
+ * @details A value with the unit of its predecessor costs one comparison; any other
+ * unit is found among the units seen so far and parsed only on its first use.
+ */
+template<class Text>
+static UnitColumn group(std::span<const Text> units, Dimension dimension) {
+    UnitColumn column;
+    column.slots.resize(units.size());
+    std::vector<std::string_view> names;
+    std::string_view last;
+    std::uint8_t slot = 0;
+    for (std::size_t i = 0; i < units.size(); ++i) {
+        const std::string_view unit = units[i];
+        if (names.empty() || unit != last) {
+            const std::size_t index = static_cast<std::size_t>(std::find(names.begin(), names.end(), unit) - names.begin());
+            if (index == names.size()) {
+                column.factors.push_back(SIConverter::parse(unit, dimension).factor);
+                names.push_back(unit);
+            }
+            slot = static_cast<std::uint8_t>(index);
+            last = unit;
+        }
+        column.slots[i] = slot;
     }
-    if (unit == "ft2") {
-        return value * 0.092903; // 1 ft² = 0.092903 m²
+    return column;
+}
+
+static void scale(double* __restrict values, std::size_t count, double factor) {
+    for (std::size_t i = 0; i < count; ++i) {
+        values[i] *= factor;
     }
-    // Default to m2 if unit is "m2" or unknown
-    return value;
 }
 
-double SIConverter::toMass(double value, const std::string& unit) {
-    if (unit == "g") {
-        return value * 1e-3; // 1 g = 0.001 kg
+template<class Text>
+static void convertColumn(std::span<double> values, std::span<const Text> units, Dimension dimension) {
+    if (values.size() != units.size()) {
+        throw SiVAL::Exceptions::OutOfRange("Value and unit columns differ in length.");
     }
-    if (unit == "oz") {
-        return value * 0.0283495; // 1 oz = 0.0283495 kg
+    // Erst alle Einheiten auflösen, dann skalieren: bei einem Fehler bleibt die Spalte unverändert
+    const UnitColumn column = group(units, dimension);
+    if (column.factors.size() == 1) {
+        scale(values.data(), values.size(), column.factors[0]);
+        return;
     }
-    if (unit == "lb") {
-        return value * 0.453592; // 1 lb = 0.453592 kg
+    double* __restrict v = values.data();
+    const std::uint8_t* __restrict slots = column.slots.data();
+    const double* __restrict factors = column.factors.data();
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        v[i] *= factors[slots[i]];
     }
-    // Default to kg if unit is "kg" or unknown
-    return value;
 }
 
-double SIConverter::toLength(double value, const std::string& unit) {
-    if (unit == "mm") {
-        return value * 1e-3; // 1 mm = 0.001 m
+const char* SIConverter::name(Dimension dimension) {
+    switch (dimension) {
+    case Dimension::Length:
+        return "length";
+    case Dimension::Area:
+        return "area";
+    case Dimension::Volume:
+        return "volume";
+    case Dimension::Mass:
+        return "mass";
     }
-    if (unit == "cm") {
-        return value * 1e-2; // 1 cm = 0.01 m
-    }
-    if (unit == "in") {
-        return value * 0.0254; // 1 in = 0.0254 m
+    return "unknown";
+}
+
+Unit SIConverter::parse(std::string_view unit) {
+    for (const UnitName &entry : kUnits) {
+        if (entry.name == unit) {
+            return entry.unit;
+        }
     }
-    if (unit == "ft") {
-        return value * 0.3048; // 1 ft = 0.3048 m
+    throw SiVAL::Exceptions::UnknownUnit("Unknown unit: \"" + std::string(unit) + "\"");
+}
+
+Unit SIConverter::parse(std::string_view unit, Dimension dimension) {
+    const Unit parsed = parse(unit);
+    if (parsed.dimension != dimension) {
+        throw SiVAL::Exceptions::UnknownUnit("\"" + std::string(unit) + "\" is no unit of " + name(dimension));
     }
-    // Default to m if unit is "m" or unknown
-    return value;
+    return parsed;
+}
+
+double SIConverter::toArea(double value, const std::string& unit) {
+    return parse(unit, Dimension::Area).toSI(value);
+}
+
+double SIConverter::toMass(double value, const std::string& unit) {
+    return parse(unit, Dimension::Mass).toSI(value);
+}
+
+double SIConverter::toLength(double value, const std::string& unit) {
+    return parse(unit, Dimension::Length).toSI(value);
 }
 
 double SIConverter::toVolume(double value, const std::string& unit) {
-    if (unit == "L" || unit == "l" || unit == "dm3") {
-        return value * 1e-3; // 1 L = 0.001 m³
-    }
-    if (unit == "cm3") {
-        return value * 1e-6; // 1 cm³ = 0.000001 m³
-    }
-    if (unit == "in3") {
-        return value * 1.63871e-5; // 1 in³ = 0.0000163871 m³
-    }
-    if (unit == "ft3") {
-        return value * 0.0283168; // 1 ft³ = 0.0283168 m³
-    }
-    // Default to m3 if unit is "m3" or unknown
-    return value;
+    return parse(unit, Dimension::Volume).toSI(value);
+}
+
+void SIConverter::toSI(std::span<double> values, Unit unit) {
+    scale(values.data(), values.size(), unit.factor);
+}
+
+void SIConverter::toSI(std::span<double> values, std::span<const std::string_view> units, Dimension dimension) {
+    convertColumn(values, units, dimension);
+}
+
+void SIConverter::toSI(std::span<double> values, std::span<const std::string> units, Dimension dimension) {
+    convertColumn(values, units, dimension);
 }
 //// end static functions
 
@@ -0,0 +1,76 @@
+/*
+ * libSiVAL
+ *
+ * Copyright (C) since 2025 Bruno Pierucki
+ *
+ * Author: Bruno Pierucki <b.pierucki@gmx.de>
+ */
+
+//// begin includes
+//// end includes
+
+//// begin system includes
+#include <mutex>
+//// end system includes
+
+//// begin project specific includes
+#include "sival/utils/stringinterner.hpp"
+//// end project specific includes
+
+//// begin using namespaces
+//// end using namespaces
+
+//// begin global definition
+//// end global definition
+
+//// begin extern declaration
+//// end extern declaration
+
+//// begin static definitions
+//// end static definitions
+
+namespace SiVAL::Utils {
+//// begin static functions
+//// end static functions
+
+//// begin public member methods
+StringInterner::StringInterner() {
+}
+StringInterner::~StringInterner() {
+}
+StringInterner& StringInterner::global() {
+    static StringInterner interner;
+    return interner;
+}
+const std::string& StringInterner::intern(std::string_view text) {
+    {
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        const auto found = m_strings.find(text);
+        if (found != m_strings.end()) {
+            return *found;
+        }
+    }
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    return *m_strings.emplace(text).first;
+}
+std::size_t StringInterner::size() const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return m_strings.size();
+}
+//// end public member methods
+
+//// begin public member methods (internal use only)
+//// end public member methods (internal use only)
+
+//// begin protected member methods
+//// end protected member methods
+
+//// begin protected member methods (internal use only)
+//// end protected member methods (internal use only)
+
+//// begin private member methods
+std::size_t StringInterner::Hash::operator()(std::string_view text) const {
+    return std::hash<std::string_view>()(text);
+}
+//// end private member methods
+}